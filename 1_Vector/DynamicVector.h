@@ -70,6 +70,24 @@ public:
         current_size++;
     }
 
+    /**
+     * @brief Grows the underlying array to hold at least `new_capacity` elements,
+     * so that the following push_back calls do not reallocate. Never shrinks.
+     * @param new_capacity The minimum capacity required.
+     */
+    void reserve(int new_capacity) {
+        if (new_capacity <= capacity) {
+            return;
+        }
+        T* new_arr = new T[new_capacity];
+        for (int i = 0; i < current_size; ++i) {
+            new_arr[i] = arr[i];
+        }
+        delete[] arr;
+        arr = new_arr;
+        capacity = new_capacity;
+    }
+
     /**
      * @brief Removes the last element from the vector.
      * Does not shrink the underlying array.
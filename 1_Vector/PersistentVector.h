@@ -0,0 +1,285 @@
+#ifndef PERSISTENT_VECTOR_H
+#define PERSISTENT_VECTOR_H
+
+#include <atomic>
+#include <memory>
+#include <stdexcept> // Required for std::out_of_range
+
+/**
+ * @brief A vector whose copies are O(1) snapshots that share storage.
+ *
+ * Elements live in fixed-size chunks of 2^ChunkBits elements, which are the
+ * leaves of a tree with the same fan-out (a persistent vector trie, as in
+ * Clojure or RRB-vectors without the relaxed nodes). The last, partially
+ * filled chunk is kept aside as the "tail", so push_back touches only that chunk.
+ *
+ * Copying a PersistentVector copies three pointers' worth of state and bumps two
+ * reference counts. All chunks and nodes are then shared. A write clones only the
+ * nodes on the path to the element that are still shared with another copy:
+ * at most depth + 1 chunks, after which that path is exclusive again and later
+ * writes to it are in place.
+ *
+ * Thread safety: a node is modified only while this object holds the sole
+ * reference to it, so a snapshot can be read (and destroyed) on another thread
+ * while the original keeps changing. Take the snapshot on the writing thread,
+ * then hand it over; a single PersistentVector object is not itself thread-safe.
+ * @tparam T The type of elements to be stored. Must be default-constructible.
+ * @tparam ChunkBits log2 of the chunk size; the default 5 gives 32-element chunks.
+ */
+template<typename T, int ChunkBits = 5>
+class PersistentVector {
+    static_assert(ChunkBits >= 1 && ChunkBits <= 10, "Chunks hold between 2 and 1024 elements.");
+
+private:
+    // --- Private Inner Structures ---
+
+    static constexpr int WIDTH = 1 << ChunkBits;
+    static constexpr int MASK = WIDTH - 1;
+
+    // Common base, so that inner nodes can point at either kind of child.
+    // shared_ptr keeps the deleter of the real type, so no virtual destructor is needed.
+    struct Node {};
+
+    struct Branch : Node {
+        std::shared_ptr<Node> children[WIDTH];
+    };
+
+    struct Leaf : Node {
+        T items[WIDTH] {};
+    };
+
+    int current_size = 0;                 // Number of elements currently stored in the vector
+    int shift = ChunkBits;                // Index bits consumed below the root
+    std::shared_ptr<Node> root = std::make_shared<Branch>();
+    std::shared_ptr<Node> tail;           // The last chunk, outside the tree
+
+    /**
+     * @brief Makes the node in `slot` exclusive to this vector, cloning it if any
+     * other vector still references it.
+     */
+    template<typename N>
+    static N* own(std::shared_ptr<Node>& slot) {
+        if (slot.use_count() != 1) {
+            slot = std::make_shared<N>(*static_cast<N*>(slot.get()));
+        } else {
+            // Pairs with the release in the decrement of the last other owner,
+            // so its reads of the node happen before our writes. (ThreadSanitizer
+            // does not model fences, so it reports these writes as races.)
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return static_cast<N*>(slot.get());
+    }
+
+    // Index of the first element stored in the tail.
+    int tail_offset() const {
+        return current_size == 0 ? 0 : ((current_size - 1) >> ChunkBits) << ChunkBits;
+    }
+
+    // Returns the chunk holding element `index` (which must be in range).
+    const Leaf* chunk_for(int index) const {
+        if (index >= tail_offset()) {
+            return static_cast<const Leaf*>(tail.get());
+        }
+        return static_cast<const Leaf*>(tree_slot(index).get());
+    }
+
+    // Returns the pointer to the tree chunk holding element `index` (before the tail).
+    const std::shared_ptr<Node>& tree_slot(int index) const {
+        const std::shared_ptr<Node>* slot = &root;
+        for (int level = shift; level > 0; level -= ChunkBits) {
+            slot = &static_cast<const Branch*>(slot->get())->children[(index >> level) & MASK];
+        }
+        return *slot;
+    }
+
+    // Builds a chain of single-child branches from `level` down to `leaf`.
+    static std::shared_ptr<Node> new_path(int level, std::shared_ptr<Node> leaf) {
+        if (level == 0) {
+            return leaf;
+        }
+        auto branch = std::make_shared<Branch>();
+        branch->children[0] = new_path(level - ChunkBits, std::move(leaf));
+        return branch;
+    }
+
+    // Hangs the full tail below `slot` (a branch at `level`) as the chunk for the
+    // elements just before current_size.
+    void push_tail(int level, std::shared_ptr<Node>& slot, std::shared_ptr<Node> leaf) {
+        Branch* branch = own<Branch>(slot);
+        int child = ((current_size - 1) >> level) & MASK;
+        if (level == ChunkBits) {
+            branch->children[child] = std::move(leaf);
+        } else if (branch->children[child]) {
+            push_tail(level - ChunkBits, branch->children[child], std::move(leaf));
+        } else {
+            branch->children[child] = new_path(level - ChunkBits, std::move(leaf));
+        }
+    }
+
+    // Detaches the last chunk of the tree below `slot`, resetting branches that
+    // become empty.
+    void pop_tail(int level, std::shared_ptr<Node>& slot) {
+        int child = ((current_size - 2) >> level) & MASK;
+        if (level > ChunkBits) {
+            Branch* branch = own<Branch>(slot);
+            pop_tail(level - ChunkBits, branch->children[child]);
+            if (child == 0 && !branch->children[0]) {
+                slot.reset();
+            }
+        } else if (child == 0) {
+            slot.reset();
+        } else {
+            own<Branch>(slot)->children[child].reset();
+        }
+    }
+
+public:
+    // --- Constructors ---
+
+    /**
+     * @brief Default constructor. Creates an empty vector.
+     */
+    PersistentVector() = default;
+
+    // Copy construction and assignment are the O(1) snapshot: the implicit
+    // versions copy the two shared pointers and never touch the elements.
+
+    /**
+     * @brief Returns an O(1) snapshot that later writes to this vector do not affect.
+     */
+    PersistentVector snapshot() const {
+        return *this;
+    }
+
+    // --- Core Functionality ---
+
+    /**
+     * @brief Appends a new element to the end of the vector. O(1) while the tail
+     * chunk has room; otherwise the tail joins the tree (O(log n) nodes touched).
+     * @param data The element to add.
+     */
+    void push_back(const T& data) {
+        int in_tail = current_size - tail_offset();
+        if (in_tail < WIDTH) {
+            if (!tail) {
+                tail = std::make_shared<Leaf>();
+            }
+            own<Leaf>(tail)->items[in_tail] = data;
+            current_size++;
+            return;
+        }
+
+        // The tail is full: move it into the tree and start a new one.
+        if ((current_size >> ChunkBits) > (1 << shift)) {
+            // The tree is full at this height: grow a new root.
+            auto new_root = std::make_shared<Branch>();
+            new_root->children[0] = std::move(root);
+            new_root->children[1] = new_path(shift, std::move(tail));
+            root = std::move(new_root);
+            shift += ChunkBits;
+        } else {
+            push_tail(shift, root, std::move(tail));
+        }
+        tail = std::make_shared<Leaf>();
+        static_cast<Leaf*>(tail.get())->items[0] = data;
+        current_size++;
+    }
+
+    /**
+     * @brief Removes the last element from the vector.
+     */
+    void pop_back() {
+        if (current_size == 0) {
+            return;
+        }
+        if (current_size == 1 || current_size - tail_offset() > 1) {
+            current_size--;
+            return;
+        }
+
+        // The tail held one element: the last chunk of the tree becomes the tail.
+        tail = tree_slot(current_size - 2);
+        pop_tail(shift, root);
+        if (!root) {
+            root = std::make_shared<Branch>();
+        }
+        if (shift > ChunkBits && !static_cast<Branch*>(root.get())->children[1]) {
+            // Only one subtree is left: drop a level.
+            std::shared_ptr<Node> only_child = static_cast<Branch*>(root.get())->children[0];
+            root = std::move(only_child);
+            shift -= ChunkBits;
+        }
+        current_size--;
+    }
+
+    /**
+     * @brief Replaces the element at `index`, cloning only the still-shared chunks
+     * on its path. O(log n).
+     * @throws std::out_of_range if the index is out of bounds.
+     */
+    void set(int index, const T& data) {
+        if (index < 0 || index >= current_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        if (index >= tail_offset()) {
+            own<Leaf>(tail)->items[index & MASK] = data;
+            return;
+        }
+        std::shared_ptr<Node>* slot = &root;
+        for (int level = shift; level > 0; level -= ChunkBits) {
+            slot = &own<Branch>(*slot)->children[(index >> level) & MASK];
+        }
+        own<Leaf>(*slot)->items[index & MASK] = data;
+    }
+
+    // --- Element Access ---
+
+    /**
+     * @brief Accesses the element at a specific index with bounds checking.
+     * Writes go through set().
+     * @throws std::out_of_range if the index is out of bounds.
+     */
+    const T& at(int index) const {
+        if (index < 0 || index >= current_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    /**
+     * @brief Accesses the element at a specific index without bounds checking.
+     */
+    const T& operator[](int index) const {
+        return chunk_for(index)->items[index & MASK];
+    }
+
+    /**
+     * @brief Calls `visit(element)` for every element in order, one chunk at a time,
+     * which avoids a tree walk per element.
+     */
+    template<typename Visitor>
+    void for_each(Visitor visit) const {
+        for (int start = 0; start < current_size; start += WIDTH) {
+            const Leaf* chunk = chunk_for(start);
+            int end = current_size - start < WIDTH ? current_size - start : WIDTH;
+            for (int i = 0; i < end; ++i) {
+                visit(chunk->items[i]);
+            }
+        }
+    }
+
+    // --- Capacity and Size ---
+
+    /**
+     * @brief Returns the number of elements in the vector.
+     */
+    int size() const {
+        return current_size;
+    }
+
+    bool empty() const {
+        return current_size == 0;
+    }
+};
+
+#endif // PERSISTENT_VECTOR_H
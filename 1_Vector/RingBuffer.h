@@ -0,0 +1,206 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept> // Required for std::out_of_range
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Selects how a RingBuffer may be shared between threads.
+ */
+enum class RingBufferMode {
+    SingleThread, // Plain indices; use from one thread only
+    SPSC          // Lock-free single-producer/single-consumer queue
+};
+
+/**
+ * @brief A fixed-capacity circular buffer with inline storage.
+ *
+ * The capacity is a power of two, so positions wrap with a mask instead of a
+ * division. The head and tail counters grow without bound (they are only ever
+ * masked), which makes full and empty easy to tell apart without wasting a slot.
+ *
+ * In SingleThread mode the buffer also keeps the last-N window API: push_back()
+ * overwrites the oldest element when full, and operator[] indexes from the oldest.
+ *
+ * In SPSC mode exactly one producer thread calls try_push() and exactly one
+ * consumer thread calls try_pop(), without locks. The head (written by the
+ * consumer) and the tail (written by the producer) sit on separate cache lines so
+ * the two threads do not falsely share them. Each side also keeps a private copy
+ * of the other side's index and re-reads the shared one only when the copy says
+ * the buffer is full (or empty), which keeps cache-line transfers rare. In
+ * SingleThread mode the copies are refreshed on every call, so the queue and
+ * last-N window APIs may be mixed freely.
+ * @tparam T The type of elements to be stored. Must be default-constructible.
+ * @tparam N The capacity. Must be a power of two.
+ * @tparam Mode SingleThread or SPSC.
+ */
+template<typename T, size_t N, RingBufferMode Mode = RingBufferMode::SingleThread>
+class RingBuffer {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "RingBuffer capacity must be a power of two.");
+
+private:
+    static constexpr bool SPSC = Mode == RingBufferMode::SPSC;
+    static constexpr size_t MASK = N - 1;
+
+    // Destructive interference size on current x86-64 and most ARM cores.
+    static constexpr size_t CACHE_LINE = 64;
+    // Only the SPSC mode pays for padding the indices apart.
+    static constexpr size_t INDEX_ALIGNMENT = SPSC ? CACHE_LINE : alignof(size_t);
+
+    using Index = typename std::conditional<SPSC, std::atomic<size_t>, size_t>::type;
+
+    // Consumer side: the shared head plus the consumer's copy of the tail.
+    alignas(INDEX_ALIGNMENT) Index head{0}; // Count of elements ever popped
+    size_t cached_tail = 0;
+
+    // Producer side: the shared tail plus the producer's copy of the head.
+    alignas(INDEX_ALIGNMENT) Index tail{0}; // Count of elements ever pushed
+    size_t cached_head = 0;
+
+    alignas(INDEX_ALIGNMENT) T slots[N] {};
+
+    static size_t load(const Index& index, std::memory_order order) {
+        if constexpr (SPSC) {
+            return index.load(order);
+        } else {
+            (void)order;
+            return index;
+        }
+    }
+
+    static void store(Index& index, size_t value, std::memory_order order) {
+        if constexpr (SPSC) {
+            index.store(value, order);
+        } else {
+            (void)order;
+            index = value;
+        }
+    }
+
+public:
+    RingBuffer() = default;
+
+    // The indices may be atomics; copying a live queue is not meaningful.
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    // --- Queue Operations (both modes) ---
+
+    /**
+     * @brief Appends an element unless the buffer is full. In SPSC mode, call only
+     * from the producer thread.
+     * @return true if the element was added, false if the buffer was full.
+     */
+    bool try_push(const T& value) {
+        size_t t = load(tail, std::memory_order_relaxed);
+        if constexpr (!SPSC) {
+            cached_head = head; // push_back/pop_front/clear move head without touching the copy
+        }
+        if (t - cached_head >= N) {
+            cached_head = load(head, std::memory_order_acquire);
+            if (t - cached_head >= N) {
+                return false;
+            }
+        }
+        slots[t & MASK] = value;
+        store(tail, t + 1, std::memory_order_release); // Publishes the slot to the consumer
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element into `out` unless the buffer is empty.
+     * In SPSC mode, call only from the consumer thread.
+     * @return true if an element was removed, false if the buffer was empty.
+     */
+    bool try_pop(T& out) {
+        size_t h = load(head, std::memory_order_relaxed);
+        if constexpr (!SPSC) {
+            cached_tail = tail;
+        }
+        if (h >= cached_tail) {
+            cached_tail = load(tail, std::memory_order_acquire);
+            if (h >= cached_tail) {
+                return false;
+            }
+        }
+        out = std::move(slots[h & MASK]);
+        store(head, h + 1, std::memory_order_release); // Hands the slot back to the producer
+        return true;
+    }
+
+    /**
+     * @brief Returns the number of stored elements. In SPSC mode this is a snapshot
+     * that may already be stale when it returns.
+     */
+    size_t size() const {
+        size_t h = load(head, std::memory_order_acquire);
+        return load(tail, std::memory_order_acquire) - h;
+    }
+
+    bool empty() const { return size() == 0; }
+    bool full() const { return size() == N; }
+    constexpr size_t get_capacity() const { return N; }
+
+    // --- Last-N Window (SingleThread mode only) ---
+
+    /**
+     * @brief Appends an element, overwriting the oldest one when the buffer is full.
+     */
+    void push_back(const T& value) {
+        static_assert(!SPSC, "push_back overwrites; use try_push in SPSC mode.");
+        if (tail - head == N) {
+            head++;
+        }
+        slots[tail & MASK] = value;
+        tail++;
+    }
+
+    /**
+     * @brief Removes the oldest element, if any.
+     */
+    void pop_front() {
+        static_assert(!SPSC, "Use try_pop in SPSC mode.");
+        if (tail != head) {
+            head++;
+        }
+    }
+
+    void clear() {
+        static_assert(!SPSC, "clear() is not thread-safe in SPSC mode.");
+        head = tail;
+    }
+
+    /**
+     * @brief Accesses the element `index` positions after the oldest one.
+     * @throws std::out_of_range if the index is out of bounds.
+     */
+    T& at(size_t index) {
+        static_assert(!SPSC, "Element access is not thread-safe in SPSC mode.");
+        if (index >= tail - head) {
+            throw std::out_of_range("Index out of range");
+        }
+        return slots[(head + index) & MASK];
+    }
+
+    /**
+     * @brief Accesses the element `index` positions after the oldest one, without
+     * bounds checking.
+     */
+    T& operator[](size_t index) {
+        static_assert(!SPSC, "Element access is not thread-safe in SPSC mode.");
+        return slots[(head + index) & MASK];
+    }
+
+    const T& operator[](size_t index) const {
+        static_assert(!SPSC, "Element access is not thread-safe in SPSC mode.");
+        return slots[(head + index) & MASK];
+    }
+
+    T& front() { return (*this)[0]; }
+    T& back() { return (*this)[tail - head - 1]; }
+};
+
+#endif // RING_BUFFER_H
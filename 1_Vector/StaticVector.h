@@ -0,0 +1,149 @@
+#ifndef STATIC_VECTOR_H
+#define STATIC_VECTOR_H
+
+#include <stdexcept> // Required for std::out_of_range and std::length_error
+
+/**
+ * @brief A fixed-capacity vector with inline storage, offering the Vector API.
+ *
+ * All N elements live inside the object itself, so a StaticVector never touches
+ * the heap and push_back never reallocates: it is meant for bounded hot-path
+ * buffers such as a batch of packets in flight. Every member function is
+ * constexpr, so a StaticVector can also be built and used at compile time.
+ * @tparam T The type of elements to be stored. Must be default-constructible
+ * (and a literal type for constexpr use).
+ * @tparam N The capacity: the maximum number of elements.
+ */
+template<typename T, int N>
+class StaticVector {
+    static_assert(N > 0, "StaticVector capacity must be positive.");
+
+private:
+    T arr[N] {};           // Inline storage; elements at or past current_size are unused
+    int current_size = 0;  // Number of elements currently stored in the vector
+
+public:
+    // --- Constructors ---
+
+    /**
+     * @brief Default constructor. Creates an empty vector; no allocation takes place.
+     */
+    constexpr StaticVector() = default;
+
+    // Copying copies the N inline elements; the implicit copy operations do exactly that.
+
+    // --- Core Functionality ---
+
+    /**
+     * @brief Appends a new element to the end of the vector. Always O(1).
+     * @param data The element to add.
+     * @throws std::length_error if the vector is already full.
+     */
+    constexpr void push_back(const T& data) {
+        if (current_size == N) {
+            throw std::length_error("StaticVector capacity exceeded");
+        }
+        arr[current_size] = data;
+        current_size++;
+    }
+
+    /**
+     * @brief Appends a new element unless the vector is full.
+     * @return true if the element was added, false if the vector was full.
+     */
+    constexpr bool try_push_back(const T& data) {
+        if (current_size == N) {
+            return false;
+        }
+        arr[current_size] = data;
+        current_size++;
+        return true;
+    }
+
+    /**
+     * @brief Removes the last element from the vector.
+     */
+    constexpr void pop_back() {
+        if (current_size > 0) {
+            current_size--;
+        }
+    }
+
+    /**
+     * @brief Removes all elements. The capacity stays N.
+     */
+    constexpr void clear() {
+        current_size = 0;
+    }
+
+    // --- Element Access ---
+
+    /**
+     * @brief Accesses the element at a specific index with bounds checking.
+     * @param index The index of the element to access.
+     * @return A reference to the element at the specified index.
+     * @throws std::out_of_range if the index is out of bounds.
+     */
+    constexpr T& at(int index) {
+        if (index < 0 || index >= current_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return arr[index];
+    }
+
+    constexpr const T& at(int index) const {
+        if (index < 0 || index >= current_size) {
+            throw std::out_of_range("Index out of range");
+        }
+        return arr[index];
+    }
+
+    /**
+     * @brief Accesses the element at a specific index without bounds checking.
+     */
+    constexpr T& operator[](int index) {
+        return arr[index];
+    }
+
+    /**
+     * @brief Const version of operator[] for read-only access.
+     */
+    constexpr const T& operator[](int index) const {
+        return arr[index];
+    }
+
+    constexpr T* data() { return arr; }
+    constexpr const T* data() const { return arr; }
+
+    // Pointer iterators, so that range-based for loops and <algorithm> work.
+    constexpr T* begin() { return arr; }
+    constexpr T* end() { return arr + current_size; }
+    constexpr const T* begin() const { return arr; }
+    constexpr const T* end() const { return arr + current_size; }
+
+    // --- Capacity and Size ---
+
+    /**
+     * @brief Returns the number of elements in the vector.
+     */
+    constexpr int size() const {
+        return current_size;
+    }
+
+    /**
+     * @brief Returns the storage capacity of the vector, which is always N.
+     */
+    constexpr int get_capacity() const {
+        return N;
+    }
+
+    constexpr bool empty() const {
+        return current_size == 0;
+    }
+
+    constexpr bool full() const {
+        return current_size == N;
+    }
+};
+
+#endif // STATIC_VECTOR_H
@@ -1,5 +1,8 @@
 #include <iostream>
 #include "DynamicVector.h"
+#include "StaticVector.h"
+#include "RingBuffer.h"
+#include "PersistentVector.h"
 
 void print_vector_stats(const Vector<int>& vec) {
     std::cout << ">> Size: " << vec.size() 
@@ -11,6 +14,15 @@ void print_vector_stats(const Vector<int>& vec) {
     std::cout << "\n------------------------------------" << std::endl;
 }
 
+// Builds a StaticVector during compilation: the first n squares.
+constexpr StaticVector<int, 8> first_squares(int n) {
+    StaticVector<int, 8> squares;
+    for (int i = 1; i <= n; ++i) {
+        squares.push_back(i * i);
+    }
+    return squares;
+}
+
 int main() {
     std::cout << "Creating a Vector<int>..." << std::endl;
     Vector<int> my_vector;
@@ -43,5 +55,62 @@ int main() {
     my_vector.pop_back();
     print_vector_stats(my_vector);
 
+    std::cout << "\n--- StaticVector<int, 8> ---" << std::endl;
+    constexpr StaticVector<int, 8> squares = first_squares(5);
+    static_assert(squares.size() == 5 && squares[4] == 25, "built at compile time");
+    std::cout << ">> Size: " << squares.size() << ", Capacity: " << squares.get_capacity() << std::endl;
+    std::cout << "   Contents: ";
+    for (int value : squares) {
+        std::cout << value << " ";
+    }
+    std::cout << std::endl;
+
+    StaticVector<int, 2> tiny;
+    tiny.push_back(1);
+    tiny.push_back(2);
+    std::cout << "try_push_back on a full StaticVector returns " << tiny.try_push_back(3) << std::endl;
+    try {
+        tiny.push_back(3);
+    } catch (const std::length_error& e) {
+        std::cout << "push_back on a full StaticVector throws: " << e.what() << std::endl;
+    }
+
+    std::cout << "\n--- RingBuffer<int, 4>: the last four samples ---" << std::endl;
+    RingBuffer<int, 4> last_samples;
+    for (int sample = 1; sample <= 6; ++sample) {
+        last_samples.push_back(sample * 10);
+    }
+    std::cout << ">> Size: " << last_samples.size() << ", Capacity: " << last_samples.get_capacity() << std::endl;
+    std::cout << "   Oldest to newest: ";
+    for (size_t i = 0; i < last_samples.size(); ++i) {
+        std::cout << last_samples[i] << " ";
+    }
+    std::cout << std::endl;
+
+    std::cout << "\n--- RingBuffer<int, 4, SPSC> as a bounded queue ---" << std::endl;
+    RingBuffer<int, 4, RingBufferMode::SPSC> queue;
+    for (int value = 1; value <= 5; ++value) {
+        bool pushed = queue.try_push(value);
+        std::cout << "try_push(" << value << ") -> " << (pushed ? "ok" : "full") << std::endl;
+    }
+    int value;
+    while (queue.try_pop(value)) {
+        std::cout << "try_pop -> " << value << std::endl;
+    }
+
+    std::cout << "\n--- PersistentVector<int>: O(1) snapshots ---" << std::endl;
+    PersistentVector<int> readings;
+    for (int i = 1; i <= 100; ++i) {
+        readings.push_back(i);
+    }
+    PersistentVector<int> snapshot = readings.snapshot(); // Shares every chunk
+    readings.set(0, -1);                                   // Clones only the chunk path of element 0
+    readings.push_back(101);
+    std::cout << "After set(0, -1) and push_back(101):" << std::endl;
+    std::cout << "   live:     size " << readings.size() << ", first " << readings[0]
+              << ", last " << readings[readings.size() - 1] << std::endl;
+    std::cout << "   snapshot: size " << snapshot.size() << ", first " << snapshot[0]
+              << ", last " << snapshot.at(snapshot.size() - 1) << std::endl;
+
     return 0;
-}
\ No newline at end of file
+}
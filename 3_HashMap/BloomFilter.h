@@ -0,0 +1,128 @@
+#ifndef BLOCKED_BLOOM_FILTER_H
+#define BLOCKED_BLOOM_FILTER_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace CustomDataStructures {
+
+/**
+ * @brief A split-block Bloom filter used as a front-end for negative lookups.
+ *
+ * Each key maps to a single 256-bit block (always inside one cache line) and sets
+ * one bit in each of the block's eight 32-bit words. A query therefore touches one
+ * cache line and is answered with one 256-bit compare, using AVX2 when the
+ * compiler targets it and an eight-word loop otherwise.
+ *
+ * The filter works on a precomputed hash (the table's std::hash value) and never
+ * gives false negatives. Keys cannot be removed; the owning table rebuilds the
+ * filter whenever it resizes.
+ */
+class BlockedBloomFilter {
+private:
+    static constexpr size_t WORDS_PER_BLOCK = 8;
+    static constexpr size_t BITS_PER_BLOCK = WORDS_PER_BLOCK * 32;
+
+    struct alignas(32) Block {
+        uint32_t words[WORDS_PER_BLOCK];
+    };
+
+    // Odd multipliers that spread one 32-bit hash into eight independent bit positions.
+    static constexpr uint32_t SALTS[WORDS_PER_BLOCK] = {
+        0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+    std::vector<Block> blocks;
+    double bits_per_key;
+
+    /**
+     * @brief Scrambles std::hash output, which for integers is the identity.
+     */
+    static uint64_t mix(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    size_t block_index(uint64_t mixed) const {
+        // Maps the high 32 bits onto [0, blocks.size()) without a division.
+        return static_cast<size_t>(((mixed >> 32) * static_cast<uint64_t>(blocks.size())) >> 32);
+    }
+
+#if defined(__AVX2__)
+    static __m256i make_mask(uint32_t h) {
+        const __m256i salts = _mm256_setr_epi32(
+            static_cast<int>(SALTS[0]), static_cast<int>(SALTS[1]), static_cast<int>(SALTS[2]), static_cast<int>(SALTS[3]),
+            static_cast<int>(SALTS[4]), static_cast<int>(SALTS[5]), static_cast<int>(SALTS[6]), static_cast<int>(SALTS[7]));
+        __m256i positions = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(h)), salts), 27);
+        return _mm256_sllv_epi32(_mm256_set1_epi32(1), positions);
+    }
+#endif
+
+public:
+    /**
+     * @brief Constructor.
+     * @param expected_keys How many keys the filter is sized for.
+     * @param bits Filter bits per expected key; 10 gives roughly a 1% false-positive rate.
+     */
+    explicit BlockedBloomFilter(size_t expected_keys = 0, double bits = 10.0) : bits_per_key(bits) {
+        reset(expected_keys);
+    }
+
+    /**
+     * @brief Clears the filter and resizes it for a new number of expected keys.
+     */
+    void reset(size_t expected_keys) {
+        size_t block_count = static_cast<size_t>(static_cast<double>(expected_keys) * bits_per_key / BITS_PER_BLOCK) + 1;
+        blocks.assign(block_count, Block());
+    }
+
+    /**
+     * @brief Adds a key, given its std::hash value.
+     */
+    void insert(size_t hash) {
+        uint64_t mixed = mix(static_cast<uint64_t>(hash));
+        Block& block = blocks[block_index(mixed)];
+#if defined(__AVX2__)
+        __m256i* words = reinterpret_cast<__m256i*>(block.words);
+        _mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), make_mask(static_cast<uint32_t>(mixed))));
+#else
+        for (size_t i = 0; i < WORDS_PER_BLOCK; ++i) {
+            block.words[i] |= 1u << ((static_cast<uint32_t>(mixed) * SALTS[i]) >> 27);
+        }
+#endif
+    }
+
+    /**
+     * @brief Checks a key, given its std::hash value.
+     * @return false if the key was definitely never inserted; true if it may have been.
+     */
+    bool may_contain(size_t hash) const {
+        uint64_t mixed = mix(static_cast<uint64_t>(hash));
+        const Block& block = blocks[block_index(mixed)];
+#if defined(__AVX2__)
+        __m256i words = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.words));
+        return _mm256_testc_si256(words, make_mask(static_cast<uint32_t>(mixed))) != 0;
+#else
+        uint32_t missing = 0;
+        for (size_t i = 0; i < WORDS_PER_BLOCK; ++i) {
+            missing |= ~block.words[i] & (1u << ((static_cast<uint32_t>(mixed) * SALTS[i]) >> 27));
+        }
+        return missing == 0;
+#endif
+    }
+
+    size_t memory_bytes() const { return blocks.size() * sizeof(Block); }
+};
+
+} // namespace CustomDataStructures
+
+#endif // BLOCKED_BLOOM_FILTER_H
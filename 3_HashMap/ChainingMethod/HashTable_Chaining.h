@@ -5,43 +5,306 @@
 #include <functional> //For hash
 #include <stdexcept>
 #include <iostream>
+#include <optional>
+#include <utility>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include "../HashTableStats.h"
+#include "../BloomFilter.h"
+#include "../ParallelBuild.h"
 
 namespace CustomDataStructures {
 
-template<typename K, typename V>
+/**
+ * @brief Where HashTable keeps its chain nodes.
+ */
+enum class ChainStorage {
+    HeapNodes, // One `new` per entry; chains link by pointer.
+    NodePool   // One contiguous, index-addressed pool with a free list; chains link by 32-bit index.
+};
+
+template<typename K, typename V, ChainStorage Storage = ChainStorage::HeapNodes>
 class HashTable {
 private:
     // --- Private Inner Structures ---
 
+    static constexpr bool POOLED = Storage == ChainStorage::NodePool;
+
+    struct Node;
+
+    // A reference to the next node in a chain: a pointer for heap nodes,
+    // an index into `pool` for pooled nodes.
+    using Link = typename std::conditional<POOLED, uint32_t, Node*>::type;
+
     // Node for our custom singly linked list.
     // Each node stores one key-value pair.
     struct Node {
         K key;
         V value;
-        Node* next;
+        Link next;
 
-        Node(const K& k, const V& v) : key(k), value(v), next(nullptr) {}
+        template<typename KK, typename VV>
+        Node(KK&& k, VV&& v) : key(std::forward<KK>(k)), value(std::forward<VV>(v)), next(NIL) {}
     };
 
+    static constexpr Link nil_link() {
+        if constexpr (POOLED) {
+            return std::numeric_limits<uint32_t>::max();
+        } else {
+            return nullptr;
+        }
+    }
+
+    // The end-of-chain marker.
+    static constexpr Link NIL = nil_link();
+
     // --- Member Variables ---
 
-    // The underlying storage is a vector of Node pointers.
-    // Each element is a pointer to the head of a linked list (a chain).
-    std::vector<Node*> table;
+    // The underlying storage is a vector of links.
+    // Each element links to the head of a linked list (a chain).
+    std::vector<Link> table;
     size_t current_size;
     std::hash<K> hash_function;
 
+    // Only used in NodePool mode: every node ever allocated, and the head of the
+    // list of released nodes (threaded through their `next` links).
+    std::vector<Node> pool;
+    Link free_list = NIL;
+
+    // Optional front-end that answers most lookups of absent keys without touching
+    // the table. Null unless enable_bloom_filter() was called.
+    std::unique_ptr<BlockedBloomFilter> filter;
+
+    // Running totals reported by stats().
+    size_t resize_count = 0;
+    double rehash_ms = 0;
+    mutable ProbeCounter probe_counter; // Empty unless HASH_TABLE_PROBE_STATS is defined
+
+    /**
+     * @brief Resolves a link to the node it refers to.
+     */
+    Node* node_at(Link link) {
+        if constexpr (POOLED) {
+            return &pool[link];
+        } else {
+            return link;
+        }
+    }
+
+    const Node* node_at(Link link) const {
+        if constexpr (POOLED) {
+            return &pool[link];
+        } else {
+            return link;
+        }
+    }
+
+    /**
+     * @brief Creates a node for a new entry. Pooled nodes are taken from the free
+     * list first, and only appended to the pool when it is empty.
+     */
+    template<typename KK, typename VV>
+    Link create_node(KK&& key, VV&& value) {
+        if constexpr (POOLED) {
+            if (free_list != NIL) {
+                Link reused = free_list;
+                Node& node = pool[reused];
+                free_list = node.next;
+                node.key = std::forward<KK>(key);
+                node.value = std::forward<VV>(value);
+                node.next = NIL;
+                return reused;
+            }
+            if (pool.size() >= NIL) {
+                throw std::length_error("HashTable node pool exceeds 32-bit index range.");
+            }
+            pool.emplace_back(std::forward<KK>(key), std::forward<VV>(value));
+            return static_cast<Link>(pool.size() - 1);
+        } else {
+            return new Node(std::forward<KK>(key), std::forward<VV>(value));
+        }
+    }
+
+    /**
+     * @brief Releases a node that has been unlinked from its chain. A pooled node
+     * keeps its key and value until it is reused.
+     */
+    void destroy_node(Link link) {
+        if constexpr (POOLED) {
+            pool[link].next = free_list;
+            free_list = link;
+        } else {
+            delete link;
+        }
+    }
+
+    // How many keys ahead of the one being resolved the batched operations prefetch.
+    static constexpr size_t PREFETCH_DISTANCE = 16;
+
+    // Marks a batch key that the Bloom filter has already ruled out.
+    static constexpr size_t NO_BUCKET = static_cast<size_t>(-1);
+
+    /**
+     * @brief Hints the CPU to start loading the cache line holding `address`.
+     */
+    static void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#else
+        (void)address;
+#endif
+    }
+
+    /**
+     * @brief Issues the two prefetch stages for a batch whose bucket indices are known.
+     * Stage 1 pulls in the bucket's head pointer for the key PREFETCH_DISTANCE ahead;
+     * stage 2 reads the (by now cached) head pointer of a nearer key and pulls in its
+     * first node, so that both misses are in flight before the key is resolved.
+     */
+    void prefetch_ahead(const std::vector<size_t>& indices, size_t i) const {
+        if (i + PREFETCH_DISTANCE < indices.size() && indices[i + PREFETCH_DISTANCE] != NO_BUCKET) {
+            prefetch(&table[indices[i + PREFETCH_DISTANCE]]);
+        }
+        if (i + PREFETCH_DISTANCE / 2 < indices.size() && indices[i + PREFETCH_DISTANCE / 2] != NO_BUCKET) {
+            Link head = table[indices[i + PREFETCH_DISTANCE / 2]];
+            if (head != NIL) {
+                prefetch(node_at(head));
+            }
+        }
+    }
+
+    /**
+     * @brief Walks one chain looking for a key.
+     * @return The node holding the key, or nullptr if it is not in the chain.
+     */
+    Node* find_in_chain(Link current, const K& key) {
+        size_t probes = 0;
+        while (current != NIL) {
+            probes++;
+            Node* node = node_at(current);
+            if (node->key == key) {
+                probe_counter.record(probes);
+                return node;
+            }
+            current = node->next;
+        }
+        probe_counter.record(probes);
+        return nullptr;
+    }
+
+    const Node* find_in_chain(Link current, const K& key) const {
+        return const_cast<HashTable*>(this)->find_in_chain(current, key);
+    }
+
+    /**
+     * @brief Inserts or updates a key in a known bucket. Does not check the load factor.
+     * @param hash The key's hash, already computed by the caller; feeds the Bloom filter.
+     */
+    void insert_into_bucket(size_t index, size_t hash, const K& key, const V& value) {
+        Link head = table[index];
+
+        // Traverse the chain to check if the key already exists
+        if (Node* existing = find_in_chain(head, key)) {
+            existing->value = value; // Update existing key
+            return;
+        }
+
+        // If key not found, create a new node and prepend it to the chain
+        Link newNode = create_node(key, value);
+        node_at(newNode)->next = head;
+        table[index] = newNode;
+        current_size++;
+        if (filter) {
+            filter->insert(hash);
+        }
+    }
+
+    /**
+     * @brief The single-probe core of the upsert-style operations: hashes the key once,
+     * walks its chain once, and creates the node in place if the key is absent.
+     * @param make_value Called only when a node has to be created; returns its value.
+     * @return The node holding the key, and whether it was created by this call.
+     */
+    template<typename KK, typename MakeValue>
+    std::pair<Node*, bool> find_or_create(KK&& key, MakeValue&& make_value) {
+        if (static_cast<float>(current_size) / table.size() > 0.75f) {
+            resize_and_rehash();
+        }
+
+        size_t hash = hash_function(key);
+        size_t index = hash % table.size();
+        Link head = table[index];
+        if (Node* existing = find_in_chain(head, key)) {
+            return {existing, false};
+        }
+
+        Link newNode = create_node(std::forward<KK>(key), make_value());
+        Node* node = node_at(newNode);
+        node->next = head;
+        table[index] = newNode;
+        current_size++;
+        if (filter) {
+            filter->insert(hash);
+        }
+        return {node, true};
+    }
+
     /**
      * @brief Deletes all nodes in a given chain to prevent memory leaks.
      */
-    void clear_chain(Node* head) {
-        while (head != nullptr) {
-            Node* temp = head;
-            head = head->next;
-            delete temp;
+    void clear_chain(Link head) {
+        while (head != NIL) {
+            Link temp = head;
+            head = node_at(head)->next;
+            destroy_node(temp);
+        }
+    }
+
+    /**
+     * @brief Computes the bucket index of every key in a batch, or NO_BUCKET for
+     * keys the Bloom filter rules out.
+     */
+    std::vector<size_t> bucket_indices(const std::vector<K>& keys) const {
+        std::vector<size_t> indices(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            size_t hash = hash_function(keys[i]);
+            indices[i] = (filter && !filter->may_contain(hash)) ? NO_BUCKET : hash % table.size();
+        }
+        return indices;
+    }
+
+    /**
+     * @brief Number of keys the Bloom filter is sized for: `bucket_count` at the maximum load factor.
+     */
+    static size_t filter_capacity(size_t bucket_count) { return bucket_count * 3 / 4 + 1; }
+
+    /**
+     * @brief Sizes the Bloom filter for the current bucket count and re-adds every key.
+     */
+    void rebuild_filter() {
+        filter->reset(filter_capacity(table.size()));
+        for (Link head : table) {
+            for (Link current = head; current != NIL; current = node_at(current)->next) {
+                filter->insert(hash_function(node_at(current)->key));
+            }
         }
     }
 
+    /**
+     * @brief Returns the chain a lookup has to walk: NIL if the Bloom filter rules the key out.
+     */
+    Link lookup_chain(const K& key) const {
+        size_t hash = hash_function(key);
+        if (filter && !filter->may_contain(hash)) {
+            return NIL;
+        }
+        return table[hash % table.size()];
+    }
+
     /**
      * @brief Rehashes the table when the load factor is too high.
      */
@@ -51,48 +314,127 @@ private:
 
         std::cout << "[INFO] Load factor exceeded. Resizing from " << old_capacity 
                   << " to " << new_capacity << " buckets." << std::endl;
-        
+
+        rehash_into(new_capacity, 1);
+    }
+
+    /**
+     * @brief Moves every node into a new bucket array of `new_capacity` buckets.
+     * Only links change; no node is allocated or freed. With more than one thread,
+     * nodes are first collected per old-bucket slice, then partitioned by
+     * destination bucket range so that each thread links a disjoint slice of the new table.
+     */
+    void rehash_into(size_t new_capacity, unsigned threads) {
+        auto start = std::chrono::steady_clock::now();
+        size_t old_capacity = table.size();
+
         // Create a new table with the new capacity
-        std::vector<Node*> new_table(new_capacity, nullptr);
+        std::vector<Link> new_table(new_capacity, NIL);
+        if (filter) {
+            filter->reset(filter_capacity(new_capacity)); // Refilled from the hashes computed below
+        }
 
-        // Move all nodes from the old table to the new one
-        for (size_t i = 0; i < old_capacity; ++i) {
-            Node* current_node = table[i];
-            while (current_node != nullptr) {
-                // Find the new bucket index for the current node
-                size_t new_index = hash_function(current_node->key) % new_capacity;
+        if (threads <= 1) {
+            // Move all nodes from the old table to the new one.
+            for (size_t i = 0; i < old_capacity; ++i) {
+                Link current_node = table[i];
+                while (current_node != NIL) {
+                    Node* node = node_at(current_node);
 
-                // Unlink the node from the old chain
-                Node* node_to_move = current_node;
-                current_node = current_node->next;
+                    // Find the new bucket index for the current node
+                    size_t hash = hash_function(node->key);
+                    size_t new_index = hash % new_capacity;
+                    if (filter) {
+                        filter->insert(hash);
+                    }
+
+                    // Unlink the node from the old chain
+                    Link node_to_move = current_node;
+                    current_node = node->next;
+
+                    // Prepend the node to the chain in the new table
+                    node->next = new_table[new_index];
+                    new_table[new_index] = node_to_move;
+                }
+            }
+        } else {
+            // Pass 1: every thread records the nodes of its old-bucket slice with their hash.
+            std::vector<std::vector<std::pair<Link, size_t>>> collected(threads);
+            ParallelBuild::run(threads, [&](unsigned t) {
+                auto range = ParallelBuild::chunk(old_capacity, threads, t);
+                for (size_t i = range.first; i < range.second; ++i) {
+                    for (Link current = table[i]; current != NIL; current = node_at(current)->next) {
+                        collected[t].emplace_back(current, hash_function(node_at(current)->key));
+                    }
+                }
+            });
+            std::vector<std::pair<Link, size_t>> nodes;
+            nodes.reserve(current_size);
+            for (auto& part : collected) {
+                nodes.insert(nodes.end(), part.begin(), part.end());
+                std::vector<std::pair<Link, size_t>>().swap(part);
+            }
 
-                // Prepend the node to the chain in the new table
-                node_to_move->next = new_table[new_index];
-                new_table[new_index] = node_to_move;
+            // Pass 2: every thread links the nodes whose new bucket falls in its slice.
+            auto parts = ParallelBuild::partition_indices(nodes.size(), threads, threads, [&](size_t i) {
+                return (nodes[i].second % new_capacity) * threads / new_capacity;
+            });
+            ParallelBuild::run(threads, [&](unsigned t) {
+                for (size_t k = parts.offsets[t]; k < parts.offsets[t + 1]; ++k) {
+                    const auto& moved = nodes[parts.order[k]];
+                    size_t new_index = moved.second % new_capacity;
+                    node_at(moved.first)->next = new_table[new_index];
+                    new_table[new_index] = moved.first;
+                }
+            });
+            if (filter) {
+                for (const auto& moved : nodes) {
+                    filter->insert(moved.second);
+                }
             }
         }
         
         // The old table's nodes have been moved, not copied. We just need to swap the tables.
         table = std::move(new_table);
+
+        resize_count++;
+        rehash_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * @brief Smallest bucket count, doubling from the current one, that holds `entries`
+     * without exceeding the maximum load factor.
+     */
+    size_t capacity_for(size_t entries) const {
+        size_t capacity = table.size();
+        while (static_cast<float>(entries) / capacity > 0.75f) {
+            capacity *= 2;
+        }
+        return capacity;
     }
 
 public:
+    using key_type = K;
+    using mapped_type = V;
+
     /**
      * @brief Constructor.
      * @param initial_capacity The initial number of buckets.
      */
     explicit HashTable(size_t initial_capacity = 16) : current_size(0) {
         if (initial_capacity == 0) initial_capacity = 16;
-        table.resize(initial_capacity, nullptr);
+        table.resize(initial_capacity, NIL);
     }
 
     /**
      * @brief Destructor.
-     * Cleans up all allocated nodes across all buckets.
+     * Cleans up all allocated nodes across all buckets. Pooled nodes are freed with the pool.
      */
     ~HashTable() {
-        for (Node* head : table) {
-            clear_chain(head);
+        if constexpr (!POOLED) {
+            for (Link head : table) {
+                clear_chain(head);
+            }
         }
     }
 
@@ -113,40 +455,103 @@ public:
             resize_and_rehash();
         }
 
-        size_t index = hash_function(key) % table.size();
-        Node* head = table[index];
+        size_t hash = hash_function(key);
+        insert_into_bucket(hash % table.size(), hash, key, value);
+    }
 
-        // Traverse the chain to check if the key already exists
-        Node* current = head;
-        while (current != nullptr) {
-            if (current->key == key) {
-                current->value = value; // Update existing key
-                return;
-            }
-            current = current->next;
+    // --- Single-Probe Access ---
+    // Each of these hashes the key once and walks its chain once. Keys and values
+    // passed as rvalues are moved into the table. Returned pointers stay valid until
+    // the table is next modified.
+
+    /**
+     * @brief Finds the value stored for a key.
+     * @return A pointer to the stored value, or nullptr if the key is absent.
+     */
+    V* find(const K& key) {
+        Node* node = find_in_chain(lookup_chain(key), key);
+        return node != nullptr ? &node->value : nullptr;
+    }
+
+    const V* find(const K& key) const {
+        const Node* node = find_in_chain(lookup_chain(key), key);
+        return node != nullptr ? &node->value : nullptr;
+    }
+
+    /**
+     * @brief Inserts a value constructed from `args` only if the key is absent.
+     * Nothing is constructed or moved from when the key already exists.
+     * @return The stored value and whether it was inserted.
+     */
+    template<typename... Args>
+    std::pair<V*, bool> try_emplace(const K& key, Args&&... args) {
+        auto result = find_or_create(key, [&] { return V(std::forward<Args>(args)...); });
+        return {&result.first->value, result.second};
+    }
+
+    template<typename... Args>
+    std::pair<V*, bool> try_emplace(K&& key, Args&&... args) {
+        auto result = find_or_create(std::move(key), [&] { return V(std::forward<Args>(args)...); });
+        return {&result.first->value, result.second};
+    }
+
+    /**
+     * @brief Inserts the key or overwrites its value.
+     * @return true if the key was inserted, false if an existing value was assigned.
+     */
+    template<typename KK, typename M>
+    bool insert_or_assign(KK&& key, M&& value) {
+        auto result = find_or_create(std::forward<KK>(key), [&] { return V(std::forward<M>(value)); });
+        if (!result.second) {
+            result.first->value = std::forward<M>(value);
         }
+        return result.second;
+    }
 
-        // If key not found, create a new node and prepend it to the chain
-        Node* newNode = new Node(key, value);
-        newNode->next = head;
-        table[index] = newNode;
-        current_size++;
+    /**
+     * @brief Returns the value for a key, inserting a default-constructed one if absent.
+     */
+    V& operator[](const K& key) {
+        return *try_emplace(key).first;
+    }
+
+    V& operator[](K&& key) {
+        return *try_emplace(std::move(key)).first;
+    }
+
+    /**
+     * @brief Inserts `init` if the key is absent; otherwise merges it into the stored
+     * value in place with `merge_fn(V& stored, const V& init)`.
+     * Typical use is aggregation, e.g. upsert(word, 1, [](int& n, int one) { n += one; }).
+     * @return true if the key was inserted.
+     */
+    template<typename KK, typename Init, typename MergeFn>
+    bool upsert(KK&& key, Init&& init, MergeFn&& merge_fn) {
+        auto result = find_or_create(std::forward<KK>(key), [&] { return V(std::forward<Init>(init)); });
+        if (!result.second) {
+            merge_fn(result.first->value, init);
+        }
+        return result.second;
     }
 
     /**
      * @brief Finds a value by its key.
      */
     bool search(const K& key, V& value_out) const {
-        size_t index = hash_function(key) % table.size();
-        Node* current = table[index];
+        Link current = lookup_chain(key);
+        size_t probes = 0;
 
-        while (current != nullptr) {
-            if (current->key == key) {
-                value_out = current->value;
+        while (current != NIL) {
+            probes++;
+            const Node* node = node_at(current);
+            if (node->key == key) {
+                probe_counter.record(probes);
+                value_out = node->value;
                 return true;
             }
-            current = current->next;
+            current = node->next;
         }
+        probe_counter.record(probes);
         return false;
     }
 
@@ -155,26 +560,313 @@ public:
      */
     bool remove(const K& key) {
         size_t index = hash_function(key) % table.size();
-        Node* current = table[index];
-        Node* prev = nullptr;
+        Link current = table[index];
+        Link prev = NIL;
+        size_t probes = 0;
 
-        while (current != nullptr) {
-            if (current->key == key) {
-                if (prev == nullptr) { // The node to remove is the head of the chain
-                    table[index] = current->next;
+        while (current != NIL) {
+            probes++;
+            Node* node = node_at(current);
+            if (node->key == key) {
+                probe_counter.record(probes);
+                if (prev == NIL) { // The node to remove is the head of the chain
+                    table[index] = node->next;
                 } else { // The node to remove is in the middle or at the end
-                    prev->next = current->next;
+                    node_at(prev)->next = node->next;
                 }
-                delete current;
+                destroy_node(current);
                 current_size--;
                 return true;
             }
             prev = current;
-            current = current->next;
+            current = node->next;
         }
+        probe_counter.record(probes);
         return false; // Key not found
     }
 
+    // --- Batched Operations ---
+    // These hash every key up front and then resolve them in a second pass while
+    // prefetching the buckets of keys further down the batch, so the cache misses
+    // of independent lookups overlap instead of being paid one after another.
+
+    /**
+     * @brief Looks up many keys at once.
+     * @param keys The keys to look up.
+     * @param out Resized to keys.size(); out[i] holds the value of keys[i] if it was found.
+     * @return The number of keys found.
+     */
+    size_t search_batch(const std::vector<K>& keys, std::vector<std::optional<V>>& out) const {
+        std::vector<size_t> indices = bucket_indices(keys);
+        out.assign(keys.size(), std::nullopt);
+
+        size_t found = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            prefetch_ahead(indices, i);
+            if (indices[i] == NO_BUCKET) {
+                continue;
+            }
+            if (const Node* node = find_in_chain(table[indices[i]], keys[i])) {
+                out[i] = node->value;
+                found++;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Checks many keys for membership at once.
+     * @param out Resized to keys.size(); out[i] is true if keys[i] is in the table.
+     * @return The number of keys found.
+     */
+    size_t contains_batch(const std::vector<K>& keys, std::vector<bool>& out) const {
+        std::vector<size_t> indices = bucket_indices(keys);
+        out.assign(keys.size(), false);
+
+        size_t found = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            prefetch_ahead(indices, i);
+            if (indices[i] != NO_BUCKET && find_in_chain(table[indices[i]], keys[i]) != nullptr) {
+                out[i] = true;
+                found++;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Inserts or updates many key-value pairs at once.
+     * The table is grown once up front for the whole batch, so bucket indices stay
+     * valid while the batch is being applied.
+     */
+    void insert_batch(const std::vector<std::pair<K, V>>& entries) {
+        size_t new_capacity = capacity_for(current_size + entries.size());
+        if (new_capacity != table.size()) {
+            std::cout << "[INFO] Batch exceeds load factor. Resizing from " << table.size()
+                      << " to " << new_capacity << " buckets." << std::endl;
+            rehash_into(new_capacity, 1);
+        }
+
+        std::vector<size_t> hashes(entries.size());
+        std::vector<size_t> indices(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i) {
+            hashes[i] = hash_function(entries[i].first);
+            indices[i] = hashes[i] % table.size();
+        }
+
+        for (size_t i = 0; i < entries.size(); ++i) {
+            prefetch_ahead(indices, i);
+            insert_into_bucket(indices[i], hashes[i], entries[i].first, entries[i].second);
+        }
+    }
+
+    /**
+     * @brief Reports load, chain-length distribution, resize history and memory use.
+     * Walks every chain once, so it costs O(capacity + size), but never prints or allocates per entry.
+     */
+    HashTableStats stats() const {
+        HashTableStats result;
+        result.size = current_size;
+        result.capacity = table.size();
+        result.load_factor = static_cast<double>(current_size) / table.size();
+        result.resize_count = resize_count;
+        result.rehash_ms = rehash_ms;
+
+        for (Link head : table) {
+            size_t length = 0;
+            for (Link current = head; current != NIL; current = node_at(current)->next) {
+                length++;
+            }
+            result.add_to_histogram(length);
+            result.max_displacement = std::max(result.max_displacement, length);
+        }
+
+        // Every node carries its link plus padding on top of the key and value.
+        const size_t node_extra = sizeof(Node) - sizeof(K) - sizeof(V);
+        result.memory.metadata = table.capacity() * sizeof(Link) + current_size * node_extra;
+        result.memory.keys = current_size * sizeof(K);
+        result.memory.values = current_size * sizeof(V);
+        if constexpr (POOLED) {
+            // Released and not-yet-used pool nodes are paid for but hold no entry.
+            result.memory.allocator_overhead = (pool.capacity() - current_size) * sizeof(Node);
+        } else {
+            result.memory.allocator_overhead = current_size * malloc_overhead(sizeof(Node));
+        }
+        if (filter) {
+            result.memory.metadata += filter->memory_bytes();
+        }
+
+        probe_counter.fill(result);
+        return result;
+    }
+
+    // --- Bulk Build and Rehash ---
+
+    /**
+     * @brief Rebuilds the bucket array with `bucket_count` buckets, raised if needed so
+     * that the current entries stay within the maximum load factor.
+     * @param threads Threads to relink with; 0 uses every hardware thread.
+     */
+    void rehash(size_t bucket_count, unsigned threads = 1) {
+        if (threads == 0) threads = ParallelBuild::default_threads();
+        bucket_count = std::max(bucket_count, static_cast<size_t>(1));
+        while (static_cast<float>(current_size) / bucket_count > 0.75f) {
+            bucket_count *= 2;
+        }
+        if (bucket_count != table.size()) {
+            rehash_into(bucket_count, threads);
+        }
+    }
+
+    /**
+     * @brief Grows the table once so that `entries` entries fit without further resizes.
+     * @param threads Threads to relink with; 0 uses every hardware thread.
+     */
+    void reserve(size_t entries, unsigned threads = 1) {
+        if (threads == 0) threads = ParallelBuild::default_threads();
+        size_t bucket_count = capacity_for(entries);
+        if (bucket_count != table.size()) {
+            rehash_into(bucket_count, threads);
+        }
+    }
+
+    /**
+     * @brief Inserts or updates every pair of a random-access range of (key, value)
+     * pairs using several threads.
+     *
+     * The table is presized once; keys are hashed in parallel and partitioned by
+     * destination bucket range, and each thread then fills only its own slice of
+     * buckets, so no locks are needed. When a key occurs more than once, the last
+     * occurrence wins, as with repeated insert(). In NodePool mode, K and V must be
+     * default-constructible, because node slots are reserved up front.
+     * If copying an entry throws, the entries already linked stay in the table, are
+     * counted by size(), and the exception is rethrown.
+     * @param threads Threads to use; 0 uses every hardware thread.
+     */
+    template<typename Range>
+    void build_from(const Range& entries, unsigned threads = 0) {
+        if (threads == 0) threads = ParallelBuild::default_threads();
+        size_t count = entries.size();
+        reserve(current_size + count, threads);
+        size_t bucket_count = table.size();
+
+        std::vector<size_t> hashes(count);
+        ParallelBuild::run(threads, [&](unsigned t) {
+            auto range = ParallelBuild::chunk(count, threads, t);
+            for (size_t i = range.first; i < range.second; ++i) {
+                hashes[i] = hash_function(entries[i].first);
+            }
+        });
+        auto parts = ParallelBuild::partition_indices(count, threads, threads, [&](size_t i) {
+            return (hashes[i] % bucket_count) * threads / bucket_count;
+        });
+
+        // Pooled nodes are reserved up front: partition t owns pool indices
+        // [pool_base + offsets[t], pool_base + offsets[t + 1]).
+        size_t pool_base = pool.size();
+        if constexpr (POOLED) {
+            if (pool_base + count >= NIL) {
+                throw std::length_error("HashTable node pool exceeds 32-bit index range.");
+            }
+            pool.resize(pool_base + count, Node(K(), V()));
+        }
+
+        std::vector<size_t> inserted(threads, 0);
+        std::vector<size_t> node_ends(threads); // First unused reserved pool index per partition
+        for (unsigned t = 0; t < threads; ++t) {
+            node_ends[t] = pool_base + parts.offsets[t];
+        }
+
+        // Runs even if a partition threw: whatever the threads linked is accounted for.
+        auto commit = [&] {
+            if constexpr (POOLED) {
+                // Reserved nodes that were not used (duplicates, or a failed copy) go to the free list.
+                for (unsigned t = 0; t < threads; ++t) {
+                    for (size_t k = node_ends[t]; k < pool_base + parts.offsets[t + 1]; ++k) {
+                        destroy_node(static_cast<Link>(k));
+                    }
+                }
+            }
+            for (size_t n : inserted) {
+                current_size += n;
+            }
+            if (filter) {
+                for (size_t hash : hashes) {
+                    filter->insert(hash);
+                }
+            }
+        };
+
+        try {
+            ParallelBuild::run(threads, [&](unsigned t) {
+                size_t next_node = node_ends[t];
+                size_t linked = 0;
+                // Publishes this partition's progress, also when copying an entry throws.
+                auto publish = [&] {
+                    node_ends[t] = next_node;
+                    inserted[t] = linked;
+                };
+                try {
+                    for (size_t k = parts.offsets[t]; k < parts.offsets[t + 1]; ++k) {
+                        size_t i = parts.order[k];
+                        size_t index = hashes[i] % bucket_count;
+                        const auto& entry = entries[i];
+
+                        Node* existing = nullptr;
+                        for (Link current = table[index]; current != NIL; current = node_at(current)->next) {
+                            if (node_at(current)->key == entry.first) {
+                                existing = node_at(current);
+                                break;
+                            }
+                        }
+                        if (existing != nullptr) {
+                            existing->value = entry.second;
+                            continue;
+                        }
+
+                        Link newNode;
+                        if constexpr (POOLED) {
+                            newNode = static_cast<Link>(next_node);
+                            pool[newNode].key = entry.first;
+                            pool[newNode].value = entry.second;
+                            next_node++;
+                        } else {
+                            newNode = new Node(entry.first, entry.second);
+                        }
+                        node_at(newNode)->next = table[index];
+                        table[index] = newNode;
+                        linked++;
+                    }
+                } catch (...) {
+                    publish();
+                    throw;
+                }
+                publish();
+            });
+        } catch (...) {
+            commit();
+            throw;
+        }
+        commit();
+    }
+
+    // --- Bloom Filter Front-End ---
+
+    /**
+     * @brief Puts a blocked Bloom filter in front of every lookup, so that most lookups
+     * of absent keys are answered from one cache line instead of a chain walk.
+     * Inserts keep it up to date and resizes rebuild it. Removed keys stay in the
+     * filter (raising the false-positive rate slightly) until the next resize.
+     * @param bits_per_key Filter bits per entry at the maximum load factor.
+     */
+    void enable_bloom_filter(double bits_per_key = 10.0) {
+        filter = std::make_unique<BlockedBloomFilter>(0, bits_per_key);
+        rebuild_filter();
+    }
+
+    void disable_bloom_filter() { filter.reset(); }
+    bool has_bloom_filter() const { return filter != nullptr; }
+
     size_t size() const { return current_size; }
     bool empty() const { return current_size == 0; }
 
@@ -183,13 +875,14 @@ public:
         std::cout << "Size: " << current_size << ", Capacity: " << table.size() << std::endl;
         for (size_t i = 0; i < table.size(); ++i) {
             std::cout << "Bucket " << i << ": ";
-            Node* current = table[i];
-            if (current == nullptr) {
+            Link current = table[i];
+            if (current == NIL) {
                 std::cout << "[empty]" << std::endl;
             } else {
-                while (current != nullptr) {
-                    std::cout << "[\"" << current->key << "\": " << current->value << "] -> ";
-                    current = current->next;
+                while (current != NIL) {
+                    const Node* node = node_at(current);
+                    std::cout << "[\"" << node->key << "\": " << node->value << "] -> ";
+                    current = node->next;
                 }
                 std::cout << "nullptr" << std::endl;
             }
@@ -58,5 +58,8 @@ int main() {
     std::cout << "Current size: " << student_scores.size() << std::endl;
     student_scores.print();
 
+    std::cout << "\n--- Table Statistics ---" << std::endl;
+    std::cout << student_scores.stats();
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,370 @@
+#ifndef CUCKOO_HASH_TABLE_H
+#define CUCKOO_HASH_TABLE_H
+
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <iostream>
+#include <optional>
+#include <utility>
+#include <cstdint>
+
+namespace CustomDataStructures {
+
+/**
+ * @brief A bucketized cuckoo hash table with a hard bound on lookup cost.
+ *
+ * Every key can live in exactly one of two buckets (one per hash function), and
+ * each bucket holds up to four entries. A lookup therefore compares at most
+ * 2 * BUCKET_SLOTS keys plus the few entries of a small overflow stash, no matter
+ * how the keys are distributed. Inserts make room with a breadth-first search for
+ * the shortest chain of displacements, which keeps load factors above 90%.
+ * @tparam K The key type. Must be default-constructible and hashable with std::hash.
+ * @tparam V The value type. Must be default-constructible.
+ */
+template<typename K, typename V>
+class CuckooHashTable {
+private:
+    // --- Private Inner Structures ---
+
+    static constexpr size_t BUCKET_SLOTS = 4;    // Entries per bucket
+    static constexpr size_t STASH_CAPACITY = 8;  // Entries that failed to find a bucket
+    static constexpr size_t MAX_BFS_NODES = 512; // Bound on the displacement search per insert
+    static constexpr int MAX_REHASH_ATTEMPTS = 8; // Failed rehashes tolerated by one insert
+    static constexpr float GROW_LOAD_FACTOR = 0.5f; // Below this, a failed insert reseeds instead of growing
+
+    // Keys are kept together so that scanning a bucket touches as few cache lines as possible.
+    struct Bucket {
+        K keys[BUCKET_SLOTS];
+        V values[BUCKET_SLOTS];
+        uint8_t occupied = 0; // Bit i set when slot i holds an entry
+    };
+
+    // One node of the breadth-first displacement search.
+    struct BfsEntry {
+        size_t bucket;
+        int parent; // Index of the parent entry in the search queue, -1 for the two roots
+        int slot;   // Slot of the parent bucket whose key would move into this bucket
+    };
+
+    // --- Member Variables ---
+
+    std::vector<Bucket> buckets; // Always a power of two, so indices are masked instead of divided
+    std::vector<std::pair<K, V>> stash;
+    size_t current_size;
+    std::hash<K> hash_function;
+    uint64_t seeds[2] = {0x9E3779B97F4A7C15ULL, 0xD6E8FEB86659FD93ULL}; // One per bucket choice
+    uint64_t seed_state = 0x2545F4914F6CDD1DULL;
+
+    /**
+     * @brief Scrambles a seeded std::hash output; for integers std::hash is the
+     * identity, which would make the bucket choices depend only on the low key bits.
+     */
+    static uint64_t mix(uint64_t h, uint64_t seed) {
+        h ^= seed;
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    /**
+     * @brief Computes the two candidate buckets of a key from two independently seeded
+     * mixes of its hash. They are always distinct. Keys with equal std::hash values
+     * still share both buckets, which no choice of seeds can separate.
+     */
+    std::pair<size_t, size_t> bucket_pair(const K& key) const {
+        uint64_t h = static_cast<uint64_t>(hash_function(key));
+        size_t mask = buckets.size() - 1;
+        size_t first = static_cast<size_t>(mix(h, seeds[0])) & mask;
+        size_t second = static_cast<size_t>(mix(h, seeds[1])) & mask;
+        if (second == first) {
+            second = (first + 1) & mask;
+        }
+        return {first, second};
+    }
+
+    /**
+     * @brief Returns the slot of `key` in a bucket, or -1 if it is not there.
+     */
+    int find_in_bucket(size_t bucket, const K& key) const {
+        const Bucket& b = buckets[bucket];
+        for (size_t s = 0; s < BUCKET_SLOTS; ++s) {
+            if ((b.occupied & (1u << s)) && b.keys[s] == key) {
+                return static_cast<int>(s);
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Returns the first free slot of a bucket, or -1 if it is full.
+     */
+    int free_slot(size_t bucket) const {
+        for (size_t s = 0; s < BUCKET_SLOTS; ++s) {
+            if (!(buckets[bucket].occupied & (1u << s))) {
+                return static_cast<int>(s);
+            }
+        }
+        return -1;
+    }
+
+    void place(size_t bucket, int slot, const K& key, const V& value) {
+        buckets[bucket].keys[slot] = key;
+        buckets[bucket].values[slot] = value;
+        buckets[bucket].occupied |= static_cast<uint8_t>(1u << slot);
+    }
+
+    /**
+     * @brief Checks whether a bucket already lies on the search path ending at queue[node].
+     * Displacement paths must not revisit a bucket, or the moves would overwrite each other.
+     */
+    static bool on_path(const std::vector<BfsEntry>& queue, int node, size_t bucket) {
+        for (; node != -1; node = queue[node].parent) {
+            if (queue[node].bucket == bucket) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Frees a slot in one of the two given buckets by moving keys along the
+     * shortest displacement path found by breadth-first search.
+     * @return The bucket and slot that are now free, or {0, -1} if no path was found.
+     */
+    std::pair<size_t, int> make_room(size_t first, size_t second) {
+        std::vector<BfsEntry> queue;
+        queue.reserve(MAX_BFS_NODES);
+        queue.push_back({first, -1, -1});
+        queue.push_back({second, -1, -1});
+
+        for (size_t head = 0; head < queue.size(); ++head) {
+            int empty = free_slot(queue[head].bucket);
+            if (empty != -1) {
+                // Walk back to a root, moving each parent's key into the slot freed below it.
+                int node = static_cast<int>(head);
+                while (queue[node].parent != -1) {
+                    const BfsEntry& child = queue[node];
+                    Bucket& from = buckets[queue[child.parent].bucket];
+                    place(child.bucket, empty, from.keys[child.slot], from.values[child.slot]);
+                    from.occupied &= static_cast<uint8_t>(~(1u << child.slot));
+                    empty = child.slot;
+                    node = child.parent;
+                }
+                return {queue[node].bucket, empty};
+            }
+
+            // Bucket is full: each of its keys could move to its other bucket.
+            for (size_t s = 0; s < BUCKET_SLOTS && queue.size() < MAX_BFS_NODES; ++s) {
+                std::pair<size_t, size_t> candidates = bucket_pair(buckets[queue[head].bucket].keys[s]);
+                size_t alternate = candidates.first == queue[head].bucket ? candidates.second : candidates.first;
+                if (!on_path(queue, static_cast<int>(head), alternate)) {
+                    queue.push_back({alternate, static_cast<int>(head), static_cast<int>(s)});
+                }
+            }
+        }
+        return {0, -1};
+    }
+
+    /**
+     * @brief Places a key that is known not to be in the table yet.
+     * @return false if neither a displacement path nor a stash entry was available.
+     */
+    bool insert_new(const K& key, const V& value) {
+        std::pair<size_t, size_t> candidates = bucket_pair(key);
+        std::pair<size_t, int> target = make_room(candidates.first, candidates.second);
+        if (target.second != -1) {
+            place(target.first, target.second, key, value);
+            return true;
+        }
+        if (stash.size() < STASH_CAPACITY) {
+            stash.emplace_back(key, value);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Re-inserts every entry, including the stash, into `bucket_count` buckets
+     * under freshly drawn seeds.
+     * @return false if some entry could not be placed; the table is then left exactly
+     * as it was.
+     */
+    bool rehash(size_t bucket_count) {
+        std::cout << "[INFO] Cuckoo insert failed at load factor " << load_factor()
+                  << ". Rehashing from " << buckets.size() << " to " << bucket_count << " buckets." << std::endl;
+
+        std::vector<Bucket> old_buckets = std::move(buckets);
+        std::vector<std::pair<K, V>> old_stash = std::move(stash);
+        uint64_t old_seeds[2] = {seeds[0], seeds[1]};
+        for (uint64_t& seed : seeds) {
+            seed = next_seed();
+        }
+
+        buckets.assign(bucket_count, Bucket());
+        stash.clear();
+        bool rehashed = true;
+        for (size_t i = 0; i < old_buckets.size() && rehashed; ++i) {
+            for (size_t s = 0; s < BUCKET_SLOTS && rehashed; ++s) {
+                if (old_buckets[i].occupied & (1u << s)) {
+                    rehashed = insert_new(old_buckets[i].keys[s], old_buckets[i].values[s]);
+                }
+            }
+        }
+        for (size_t i = 0; i < old_stash.size() && rehashed; ++i) {
+            rehashed = insert_new(old_stash[i].first, old_stash[i].second);
+        }
+
+        if (!rehashed) {
+            buckets = std::move(old_buckets);
+            stash = std::move(old_stash);
+            seeds[0] = old_seeds[0];
+            seeds[1] = old_seeds[1];
+        }
+        return rehashed;
+    }
+
+    /**
+     * @brief SplitMix64 step; draws the seeds for each rehash.
+     */
+    uint64_t next_seed() {
+        uint64_t z = (seed_state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+public:
+    /**
+     * @brief Constructor.
+     * @param initial_capacity Number of entries to make room for; rounded up to whole,
+     * power-of-two many buckets.
+     */
+    explicit CuckooHashTable(size_t initial_capacity = 16) : current_size(0) {
+        size_t bucket_count = 2;
+        while (bucket_count * BUCKET_SLOTS < initial_capacity) {
+            bucket_count *= 2;
+        }
+        buckets.resize(bucket_count);
+    }
+
+    ~CuckooHashTable() = default;
+
+    // Disallow copying for consistency with the other hash tables.
+    CuckooHashTable(const CuckooHashTable&) = delete;
+    CuckooHashTable& operator=(const CuckooHashTable&) = delete;
+
+    /**
+     * @brief Inserts a key-value pair or updates the value if the key already exists.
+     *
+     * When no displacement path or stash entry is free, the table is rehashed under
+     * new seeds: at twice the size if it is at least half full, otherwise at the same
+     * size, since growing cannot help keys whose hashes collide.
+     * @throws std::length_error if the key still cannot be placed after
+     * MAX_REHASH_ATTEMPTS rehashes (e.g. more than 2 * BUCKET_SLOTS + STASH_CAPACITY
+     * keys share one std::hash value). The table is left unchanged.
+     */
+    void insert(const K& key, const V& value) {
+        std::pair<size_t, size_t> candidates = bucket_pair(key);
+        for (size_t bucket : {candidates.first, candidates.second}) {
+            int slot = find_in_bucket(bucket, key);
+            if (slot != -1) {
+                buckets[bucket].values[slot] = value;
+                return;
+            }
+        }
+        for (auto& entry : stash) {
+            if (entry.first == key) {
+                entry.second = value;
+                return;
+            }
+        }
+
+        for (int attempt = 0; !insert_new(key, value); ++attempt) {
+            if (attempt == MAX_REHASH_ATTEMPTS) {
+                throw std::length_error("CuckooHashTable cannot place key: too many keys share its hash value.");
+            }
+            rehash(load_factor() >= GROW_LOAD_FACTOR ? buckets.size() * 2 : buckets.size());
+        }
+        current_size++;
+    }
+
+    /**
+     * @brief Searches for a key. Inspects at most two buckets and the stash.
+     * @return An std::optional<V> containing the value if found, otherwise empty.
+     */
+    std::optional<V> search(const K& key) const {
+        std::pair<size_t, size_t> candidates = bucket_pair(key);
+        int slot = find_in_bucket(candidates.first, key);
+        if (slot != -1) {
+            return buckets[candidates.first].values[slot];
+        }
+        slot = find_in_bucket(candidates.second, key);
+        if (slot != -1) {
+            return buckets[candidates.second].values[slot];
+        }
+        for (const auto& entry : stash) {
+            if (entry.first == key) {
+                return entry.second;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Removes a key-value pair.
+     * @return true if the key was present.
+     */
+    bool remove(const K& key) {
+        std::pair<size_t, size_t> candidates = bucket_pair(key);
+        for (size_t bucket : {candidates.first, candidates.second}) {
+            int slot = find_in_bucket(bucket, key);
+            if (slot != -1) {
+                buckets[bucket].occupied &= static_cast<uint8_t>(~(1u << slot));
+                current_size--;
+                return true;
+            }
+        }
+        for (size_t i = 0; i < stash.size(); ++i) {
+            if (stash[i].first == key) {
+                stash.erase(stash.begin() + static_cast<long>(i));
+                current_size--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t size() const { return current_size; }
+    bool empty() const { return current_size == 0; }
+    size_t capacity() const { return buckets.size() * BUCKET_SLOTS; }
+    float load_factor() const { return static_cast<float>(current_size) / capacity(); }
+
+    void print() const {
+        std::cout << "--- Cuckoo Hash Table ---" << std::endl;
+        std::cout << "Size: " << current_size << ", Capacity: " << capacity()
+                  << ", Stash: " << stash.size() << std::endl;
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            std::cout << "Bucket " << i << ": ";
+            for (size_t s = 0; s < BUCKET_SLOTS; ++s) {
+                if (buckets[i].occupied & (1u << s)) {
+                    std::cout << "[\"" << buckets[i].keys[s] << "\": " << buckets[i].values[s] << "] ";
+                } else {
+                    std::cout << "[EMPTY] ";
+                }
+            }
+            std::cout << std::endl;
+        }
+        for (const auto& entry : stash) {
+            std::cout << "Stash: [\"" << entry.first << "\": " << entry.second << "]" << std::endl;
+        }
+        std::cout << "-------------------------" << std::endl;
+    }
+};
+
+} // namespace CustomDataStructures
+
+#endif // CUCKOO_HASH_TABLE_H
@@ -0,0 +1,44 @@
+#include <iostream>
+#include <string>
+#include <optional>
+#include "CuckooHashTable.h"
+
+int main() {
+    using CustomDataStructures::CuckooHashTable;
+
+    // Two buckets of four slots: small enough to watch displacements and a resize.
+    CuckooHashTable<std::string, int> student_scores(8);
+
+    student_scores.insert("Alice", 88);
+    student_scores.insert("Bob", 92);
+    student_scores.insert("Charlie", 75);
+    student_scores.insert("David", 100);
+    student_scores.insert("Eve", 68);
+    student_scores.insert("Frank", 81);
+    std::cout << "After six inserts (load factor " << student_scores.load_factor() << "):" << std::endl;
+    student_scores.print();
+
+    std::cout << "\nInserting three more (should displace keys and eventually resize)..." << std::endl;
+    student_scores.insert("Grace", 90);
+    student_scores.insert("Heidi", 77);
+    student_scores.insert("Ivan", 64);
+    student_scores.print();
+
+    std::cout << "\n--- Testing Search ---" << std::endl;
+    if (auto score = student_scores.search("Charlie")) {
+        std::cout << "Charlie's score is: " << *score << std::endl;
+    }
+    if (auto score = student_scores.search("Mallory")) {
+        std::cout << "Mallory's score is: " << *score << std::endl;
+    } else {
+        std::cout << "Mallory not found." << std::endl;
+    }
+
+    std::cout << "\n--- Testing Update and Remove ---" << std::endl;
+    student_scores.insert("Alice", 95);
+    std::cout << "Alice's new score is: " << *student_scores.search("Alice") << std::endl;
+    student_scores.remove("Bob");
+    std::cout << "Removed Bob. Current size: " << student_scores.size() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+#ifndef HASH_TABLE_STATS_H
+#define HASH_TABLE_STATS_H
+
+#include <vector>
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+
+namespace CustomDataStructures {
+
+/**
+ * @brief A snapshot of a hash table's shape, history and memory use, returned by stats().
+ *
+ * Histograms and memory figures are computed by one pass over the buckets when
+ * stats() is called; resize figures are running totals kept by the table.
+ * Memory is shallow: heap memory owned by keys or values (e.g. std::string contents)
+ * is not included.
+ */
+struct HashTableStats {
+    // Number of histogram bins. The last bin collects every length at or above it.
+    static constexpr size_t HISTOGRAM_BINS = 16;
+
+    size_t size = 0;
+    size_t capacity = 0;    // Buckets (chaining) or slots (open addressing)
+    double load_factor = 0;
+    size_t tombstones = 0;  // DELETED slots; always 0 for chaining
+
+    // Chaining: histogram[n] is the number of buckets whose chain holds n nodes.
+    // Open addressing: histogram[n] is the number of entries found after n + 1 probes.
+    std::vector<size_t> length_histogram = std::vector<size_t>(HISTOGRAM_BINS, 0);
+
+    // Chaining: length of the longest chain.
+    // Open addressing: the farthest any entry sits from its home slot.
+    size_t max_displacement = 0;
+
+    size_t resize_count = 0;
+    double rehash_ms = 0; // Cumulative time spent in resize_and_rehash
+
+    struct Memory {
+        size_t metadata = 0;           // Bucket arrays, links, slot states and padding
+        size_t keys = 0;
+        size_t values = 0;
+        size_t allocator_overhead = 0; // Estimated malloc headers, free or reserved-but-unused storage
+
+        size_t total() const { return metadata + keys + values + allocator_overhead; }
+    } memory;
+
+    // Only filled in when compiled with HASH_TABLE_PROBE_STATS.
+    uint64_t probed_operations = 0;
+    uint64_t total_probes = 0;
+    uint64_t max_probes = 0;
+
+    void add_to_histogram(size_t length) {
+        length_histogram[length < HISTOGRAM_BINS ? length : HISTOGRAM_BINS - 1]++;
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& out, const HashTableStats& stats) {
+    out << "Size: " << stats.size << ", Capacity: " << stats.capacity
+        << ", Load factor: " << stats.load_factor << ", Tombstones: " << stats.tombstones << std::endl;
+    out << "Length histogram:";
+    for (size_t i = 0; i < stats.length_histogram.size(); ++i) {
+        if (stats.length_histogram[i] != 0) {
+            out << " " << i << (i + 1 == stats.length_histogram.size() ? "+" : "")
+                << ":" << stats.length_histogram[i];
+        }
+    }
+    out << std::endl;
+    out << "Max displacement: " << stats.max_displacement << ", Resizes: " << stats.resize_count
+        << " (" << stats.rehash_ms << " ms)" << std::endl;
+    out << "Memory: " << stats.memory.total() << " bytes (metadata " << stats.memory.metadata
+        << ", keys " << stats.memory.keys << ", values " << stats.memory.values
+        << ", allocator overhead " << stats.memory.allocator_overhead << ")" << std::endl;
+    if (stats.probed_operations != 0) {
+        out << "Probes: " << stats.total_probes << " over " << stats.probed_operations << " operations ("
+            << static_cast<double>(stats.total_probes) / stats.probed_operations
+            << " avg, " << stats.max_probes << " max)" << std::endl;
+    }
+    return out;
+}
+
+/**
+ * @brief Estimates the bookkeeping glibc malloc adds to one allocation of `request` bytes:
+ * an 8-byte header, 16-byte rounding and a 32-byte minimum chunk.
+ */
+inline size_t malloc_overhead(size_t request) {
+    size_t chunk = (request + sizeof(size_t) + 15) & ~static_cast<size_t>(15);
+    if (chunk < 32) chunk = 32;
+    return chunk - request;
+}
+
+/**
+ * @brief Counts probes per operation when HASH_TABLE_PROBE_STATS is defined.
+ * Otherwise it is empty and record() compiles away, so the default build pays nothing.
+ */
+struct ProbeCounter {
+#ifdef HASH_TABLE_PROBE_STATS
+    uint64_t operations = 0;
+    uint64_t probes = 0;
+    uint64_t max_probes = 0;
+
+    void record(size_t probe_count) {
+        operations++;
+        probes += probe_count;
+        if (probe_count > max_probes) max_probes = probe_count;
+    }
+
+    void fill(HashTableStats& stats) const {
+        stats.probed_operations = operations;
+        stats.total_probes = probes;
+        stats.max_probes = max_probes;
+    }
+#else
+    void record(size_t) {}
+    void fill(HashTableStats&) const {}
+#endif
+};
+
+} // namespace CustomDataStructures
+
+#endif // HASH_TABLE_STATS_H
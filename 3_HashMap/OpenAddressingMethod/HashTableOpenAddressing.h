@@ -6,17 +6,45 @@
 #include <stdexcept>
 #include <iostream>
 #include <optional> // Used to cleanly handle search results
+#include <utility>
+#include <memory>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <chrono>
+#include <algorithm>
+#include "../HashTableStats.h"
+#include "../BloomFilter.h"
+#include "../ParallelBuild.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HASH_TABLE_OA_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace CustomDataStructures {
 
-template<typename K, typename V>
+/**
+ * @brief How HashTableOA arranges its slots in memory.
+ */
+enum class SlotLayout {
+    Interleaved, // One array of {key, value, state} slots.
+    Split        // Separate arrays of state bytes, keys and values; probing touches only states and keys.
+};
+
+template<typename K, typename V, SlotLayout Layout = SlotLayout::Interleaved>
 class HashTableOA {
 private:
     // --- Private Inner Structures ---
 
     // An enum to represent the state of each bucket in the table.
     // This is crucial for handling deletions correctly in open addressing.
-    enum class SlotState { EMPTY, OCCUPIED, DELETED };
+    enum class SlotState : uint8_t { EMPTY, OCCUPIED, DELETED };
 
     // Represents a single slot in the hash table.
     struct Slot {
@@ -25,33 +53,225 @@ private:
         SlotState state = SlotState::EMPTY;
     };
 
+    // Snapshots store each slot array as its own region, padded to this alignment.
+    static constexpr size_t REGION_ALIGNMENT = 64;
+
+    static size_t padded(size_t bytes) {
+        return (bytes + REGION_ALIGNMENT - 1) / REGION_ALIGNMENT * REGION_ALIGNMENT;
+    }
+
+    static void write_region(std::ostream& out, const void* data, size_t bytes) {
+        static const char zeros[REGION_ALIGNMENT] = {};
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        out.write(zeros, static_cast<std::streamsize>(padded(bytes) - bytes));
+    }
+
+    // Slot storage for SlotLayout::Interleaved: every probe step loads key, value and state together.
+    // The raw pointer refers either to `owned` or to a mapped snapshot region.
+    struct InterleavedSlots {
+        std::vector<Slot> owned;
+        Slot* slots = nullptr;
+
+        void allocate(size_t capacity) {
+            owned.assign(capacity, Slot());
+            slots = owned.data();
+        }
+
+        SlotState& state(size_t i) const { return slots[i].state; }
+        K& key(size_t i) const { return slots[i].key; }
+        V& value(size_t i) const { return slots[i].value; }
+        void prefetch(size_t i) const { prefetch_address(&slots[i]); }
+
+        static size_t bytes_per_slot() { return sizeof(Slot); }
+        static size_t metadata_per_slot() { return sizeof(Slot) - sizeof(K) - sizeof(V); }
+        size_t owned_bytes() const { return owned.capacity() * sizeof(Slot); }
+
+        static size_t snapshot_bytes(size_t capacity) { return padded(capacity * sizeof(Slot)); }
+
+        void write(std::ostream& out, size_t capacity) const {
+            write_region(out, slots, capacity * sizeof(Slot));
+        }
+
+        void bind(char* base) {
+            owned = std::vector<Slot>();
+            slots = reinterpret_cast<Slot*>(base);
+        }
+    };
+
+    // Slot storage for SlotLayout::Split: one state byte per slot, then keys, then values.
+    // A probe step reads only the state and key arrays; values are read on a hit.
+    struct SplitSlots {
+        std::vector<SlotState> owned_states;
+        std::vector<K> owned_keys;
+        std::vector<V> owned_values;
+        SlotState* states = nullptr;
+        K* keys = nullptr;
+        V* values = nullptr;
+
+        void allocate(size_t capacity) {
+            owned_states.assign(capacity, SlotState::EMPTY);
+            owned_keys.assign(capacity, K());
+            owned_values.assign(capacity, V());
+            states = owned_states.data();
+            keys = owned_keys.data();
+            values = owned_values.data();
+        }
+
+        SlotState& state(size_t i) const { return states[i]; }
+        K& key(size_t i) const { return keys[i]; }
+        V& value(size_t i) const { return values[i]; }
+        void prefetch(size_t i) const {
+            prefetch_address(&states[i]);
+            prefetch_address(&keys[i]);
+        }
+
+        static size_t bytes_per_slot() { return sizeof(SlotState) + sizeof(K) + sizeof(V); }
+        static size_t metadata_per_slot() { return sizeof(SlotState); }
+        size_t owned_bytes() const {
+            return owned_states.capacity() * sizeof(SlotState) + owned_keys.capacity() * sizeof(K)
+                 + owned_values.capacity() * sizeof(V);
+        }
+
+        static size_t snapshot_bytes(size_t capacity) {
+            return padded(capacity * sizeof(SlotState)) + padded(capacity * sizeof(K)) + padded(capacity * sizeof(V));
+        }
+
+        void write(std::ostream& out, size_t capacity) const {
+            write_region(out, states, capacity * sizeof(SlotState));
+            write_region(out, keys, capacity * sizeof(K));
+            write_region(out, values, capacity * sizeof(V));
+        }
+
+        void bind(char* base, size_t capacity) {
+            owned_states = std::vector<SlotState>();
+            owned_keys = std::vector<K>();
+            owned_values = std::vector<V>();
+            states = reinterpret_cast<SlotState*>(base);
+            keys = reinterpret_cast<K*>(base + padded(capacity * sizeof(SlotState)));
+            values = reinterpret_cast<V*>(base + padded(capacity * sizeof(SlotState)) + padded(capacity * sizeof(K)));
+        }
+    };
+
+    static constexpr bool SPLIT = Layout == SlotLayout::Split;
+    using Slots = typename std::conditional<SPLIT, SplitSlots, InterleavedSlots>::type;
+
+    // Fixed-size header at the start of a snapshot file written by save().
+    // The slot regions follow immediately, starting at offset sizeof(SnapshotHeader).
+    struct alignas(64) SnapshotHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t slot_size;          // Bytes per slot across all regions, as seen by the writer
+        uint64_t capacity;           // Number of slots
+        uint64_t size;               // Number of OCCUPIED slots
+        uint64_t hasher_fingerprint; // hasher_fingerprint() of the writer, guards against a different std::hash
+        uint32_t layout;             // SlotLayout of the writer
+    };
+
+    static constexpr char SNAPSHOT_MAGIC[8] = {'H', 'T', 'O', 'A', 'S', 'N', 'A', 'P'};
+    static constexpr uint32_t SNAPSHOT_VERSION = 3;
+
+    /**
+     * @brief Combines the hashes of a few fixed, non-default keys. Hashing K() alone
+     * gives 0 for every integral key under std::hash and would accept any hasher.
+     * Keys that are neither arithmetic nor pointers can only be probed with K().
+     */
+    uint64_t hasher_fingerprint() const {
+        static constexpr uint64_t PROBES[] = {0x9E3779B97F4A7C15ULL, 0x0123456789ABCDEFULL, 0xC2B2AE3D27D4EB4FULL};
+        uint64_t fingerprint = 0xCBF29CE484222325ULL;
+        for (uint64_t probe : PROBES) {
+            K key{};
+            if constexpr (std::is_arithmetic<K>::value) {
+                key = static_cast<K>(probe);
+            } else if constexpr (std::is_pointer<K>::value) {
+                key = reinterpret_cast<K>(static_cast<uintptr_t>(probe));
+            }
+            fingerprint = (fingerprint ^ static_cast<uint64_t>(hash_function(key))) * 0x100000001B3ULL;
+        }
+        return fingerprint;
+    }
+
+#ifdef HASH_TABLE_OA_HAS_MMAP
+    // Owns a private, copy-on-write memory mapping of a snapshot file.
+    struct Mapping {
+        void* address;
+        size_t length;
+
+        Mapping(void* a, size_t l) : address(a), length(l) {}
+        ~Mapping() { munmap(address, length); }
+        Mapping(const Mapping&) = delete;
+        Mapping& operator=(const Mapping&) = delete;
+    };
+#else
+    struct Mapping {};
+#endif
+
     // --- Member Variables ---
 
-    std::vector<Slot> table;
+    // `slots` refers either to its own arrays, or to the slot regions of a mapped
+    // snapshot file after open_mapped().
+    Slots slots;
+    std::unique_ptr<Mapping> mapping;
+    size_t slot_count;
     size_t current_size; // Number of OCCUPIED slots
     std::hash<K> hash_function;
 
+    // Running totals reported by stats().
+    size_t resize_count = 0;
+    double rehash_ms = 0;
+    mutable ProbeCounter probe_counter; // Empty unless HASH_TABLE_PROBE_STATS is defined
+
+    // Optional front-end that answers most lookups of absent keys without probing
+    // the table. Null unless enable_bloom_filter() was called.
+    std::unique_ptr<BlockedBloomFilter> filter;
+
+    // How many keys ahead of the one being resolved the batched operations prefetch.
+    static constexpr size_t PREFETCH_DISTANCE = 16;
+
+    // Marks a lookup that the Bloom filter has already ruled out.
+    static constexpr size_t NO_SLOT = static_cast<size_t>(-1);
+
+    /**
+     * @brief Hints the CPU to start loading the cache line holding `address`.
+     */
+    static void prefetch_address(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#else
+        (void)address;
+#endif
+    }
+
     /**
      * @brief Finds the index for a key. Returns the index of the key if it exists,
      * or the index of the first available (EMPTY or DELETED) slot.
      * @return The index of the slot.
      */
     size_t find_slot(const K& key) const {
-        size_t index = hash_function(key) % table.size();
+        return find_slot_from(hash_function(key) % slot_count, key);
+    }
+
+    /**
+     * @brief Same as find_slot, but starts probing at an already computed home index.
+     */
+    size_t find_slot_from(size_t index, const K& key) const {
         size_t initial_index = index;
+        size_t probes = 1;
 
-        while (table[index].state != SlotState::EMPTY) {
+        while (slots.state(index) != SlotState::EMPTY) {
             // If we find an occupied slot with the correct key, return its index.
-            if (table[index].state == SlotState::OCCUPIED && table[index].key == key) {
+            if (slots.state(index) == SlotState::OCCUPIED && slots.key(index) == key) {
+                probe_counter.record(probes);
                 return index;
             }
+            probes++;
             // Move to the next slot (linear probing)
-            index = (index + 1) % table.size();
+            index = (index + 1) % slot_count;
             // If we've probed the entire table and returned to the start, the table is full.
             if (index == initial_index) {
                 throw std::runtime_error("Hash table is full, cannot find slot.");
             }
         }
+        probe_counter.record(probes);
         return index; // Return index of the first EMPTY slot found
     }
     
@@ -59,31 +279,250 @@ private:
      * @brief Rehashes the table when the load factor is too high.
      */
     void resize_and_rehash() {
-        size_t old_capacity = table.size();
+        size_t old_capacity = slot_count;
         size_t new_capacity = old_capacity * 2;
         
         std::cout << "[INFO] Load factor exceeded. Resizing from " << old_capacity 
                   << " to " << new_capacity << " slots." << std::endl;
 
-        std::vector<Slot> old_table = std::move(table);
-        table.assign(new_capacity, Slot()); // Re-initialize the table with new capacity
-        current_size = 0;
+        rehash_into(new_capacity, 1);
+    }
+
+    /**
+     * @brief Moves every entry into a new slot array of `new_capacity` slots.
+     * Entries are known to be unique, so each one goes straight to the first EMPTY
+     * slot from its home, without key comparisons. With more than one thread, entries
+     * are partitioned by home region and each thread probes only inside its own
+     * region; entries that would run past the end of their region are placed
+     * serially afterwards.
+     */
+    void rehash_into(size_t new_capacity, unsigned threads) {
+        auto start = std::chrono::steady_clock::now();
+        size_t old_capacity = slot_count;
+
+        // A mapped snapshot stays mapped until its entries have been moved out;
+        // from then on the table owns its slots.
+        Slots old_slots = std::move(slots);
+        std::unique_ptr<Mapping> old_mapping = std::move(mapping);
+        slots = Slots();
+        slots.allocate(new_capacity); // Re-initialize the table with new capacity
+        slot_count = new_capacity;
+        if (filter) {
+            filter->reset(filter_capacity()); // Refilled as entries are moved below
+        }
+
+        if (threads <= 1) {
+            // Move all OCCUPIED elements from the old table into the new one.
+            for (size_t i = 0; i < old_capacity; ++i) {
+                if (old_slots.state(i) == SlotState::OCCUPIED) {
+                    size_t hash = hash_function(old_slots.key(i));
+                    place_new(hash % slot_count, std::move(old_slots.key(i)), std::move(old_slots.value(i)));
+                    if (filter) {
+                        filter->insert(hash);
+                    }
+                }
+            }
+        } else {
+            // Pass 1: every thread records the occupied slots of its old-slot slice with their hash.
+            std::vector<std::vector<std::pair<size_t, size_t>>> collected(threads);
+            ParallelBuild::run(threads, [&](unsigned t) {
+                auto range = ParallelBuild::chunk(old_capacity, threads, t);
+                for (size_t i = range.first; i < range.second; ++i) {
+                    if (old_slots.state(i) == SlotState::OCCUPIED) {
+                        collected[t].emplace_back(i, hash_function(old_slots.key(i)));
+                    }
+                }
+            });
+            std::vector<std::pair<size_t, size_t>> entries;
+            entries.reserve(current_size);
+            for (auto& part : collected) {
+                entries.insert(entries.end(), part.begin(), part.end());
+                std::vector<std::pair<size_t, size_t>>().swap(part);
+            }
+
+            // Pass 2: every thread places the entries whose home falls in its region.
+            auto parts = ParallelBuild::partition_indices(entries.size(), threads, threads, [&](size_t k) {
+                return region_of(entries[k].second % slot_count, threads);
+            });
+            std::vector<std::vector<size_t>> overflow(threads);
+            ParallelBuild::run(threads, [&](unsigned t) {
+                size_t region_end = ParallelBuild::chunk(slot_count, threads, t).second;
+                for (size_t k = parts.offsets[t]; k < parts.offsets[t + 1]; ++k) {
+                    const auto& entry = entries[parts.order[k]];
+                    size_t index = entry.second % slot_count;
+                    while (index < region_end && slots.state(index) != SlotState::EMPTY) {
+                        index++;
+                    }
+                    if (index == region_end) {
+                        overflow[t].push_back(parts.order[k]);
+                        continue;
+                    }
+                    slots.key(index) = std::move(old_slots.key(entry.first));
+                    slots.value(index) = std::move(old_slots.value(entry.first));
+                    slots.state(index) = SlotState::OCCUPIED;
+                }
+            });
+            for (const auto& part : overflow) {
+                for (size_t k : part) {
+                    size_t old_index = entries[k].first;
+                    place_new(entries[k].second % slot_count,
+                              std::move(old_slots.key(old_index)), std::move(old_slots.value(old_index)));
+                }
+            }
+            if (filter) {
+                for (const auto& entry : entries) {
+                    filter->insert(entry.second);
+                }
+            }
+        }
+
+        resize_count++;
+        rehash_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * @brief Writes an entry known to be absent into the first EMPTY slot from `index`.
+     * Only used while rehashing, when the table holds no DELETED slots.
+     */
+    template<typename KK, typename VV>
+    void place_new(size_t index, KK&& key, VV&& value) {
+        while (slots.state(index) != SlotState::EMPTY) {
+            index = (index + 1) % slot_count;
+        }
+        slots.key(index) = std::forward<KK>(key);
+        slots.value(index) = std::forward<VV>(value);
+        slots.state(index) = SlotState::OCCUPIED;
+    }
+
+    /**
+     * @brief The region, out of `regions` equal slices of the slot array as cut by
+     * ParallelBuild::chunk, that contains slot `index`.
+     */
+    size_t region_of(size_t index, unsigned regions) const {
+        return ((index + 1) * regions - 1) / slot_count;
+    }
+
+    /**
+     * @brief Smallest slot count, doubling from the current one, that holds `entries`
+     * without reaching the maximum load factor.
+     */
+    size_t capacity_for(size_t entries) const {
+        size_t capacity = slot_count;
+        while (static_cast<float>(entries) / capacity >= 0.7f) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    /**
+     * @brief Computes the home slot of every key in a batch, or NO_SLOT for keys
+     * the Bloom filter rules out.
+     */
+    std::vector<size_t> home_indices(const std::vector<K>& keys) const {
+        std::vector<size_t> indices(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            size_t hash = hash_function(keys[i]);
+            indices[i] = (filter && !filter->may_contain(hash)) ? NO_SLOT : hash % slot_count;
+        }
+        return indices;
+    }
+
+    /**
+     * @brief Runs find_slot for a lookup, unless the Bloom filter rules the key out.
+     * @return The slot index, or NO_SLOT if the key is certainly absent.
+     */
+    size_t lookup_slot(const K& key) const {
+        size_t hash = hash_function(key);
+        if (filter && !filter->may_contain(hash)) {
+            return NO_SLOT;
+        }
+        return find_slot_from(hash % slot_count, key);
+    }
+
+    /**
+     * @brief Number of keys the Bloom filter is sized for: the slot count at the maximum load factor.
+     */
+    size_t filter_capacity() const { return slot_count * 7 / 10 + 1; }
+
+    /**
+     * @brief Sizes the Bloom filter for the current slot count and re-adds every key.
+     */
+    void rebuild_filter() {
+        filter->reset(filter_capacity());
+        for (size_t i = 0; i < slot_count; ++i) {
+            if (slots.state(i) == SlotState::OCCUPIED) {
+                filter->insert(hash_function(slots.key(i)));
+            }
+        }
+    }
+
+    /**
+     * @brief Prefetches the home slot of the key PREFETCH_DISTANCE ahead in a batch.
+     */
+    void prefetch_ahead(const std::vector<size_t>& indices, size_t i) const {
+        if (i + PREFETCH_DISTANCE < indices.size() && indices[i + PREFETCH_DISTANCE] != NO_SLOT) {
+            slots.prefetch(indices[i + PREFETCH_DISTANCE]);
+        }
+    }
 
-        // Re-insert all OCCUPIED elements from the old table into the new one.
-        for (const auto& slot : old_table) {
-            if (slot.state == SlotState::OCCUPIED) {
-                insert(slot.key, slot.value);
+    /**
+     * @brief Writes a key-value pair into the slot returned by find_slot.
+     * @param hash The key's hash, already computed by the caller; feeds the Bloom filter.
+     */
+    void store_at(size_t index, size_t hash, const K& key, const V& value) {
+        // If the slot is not currently occupied, it's a new element. It is counted only
+        // once both copies have succeeded, so a throwing copy leaves the size accurate.
+        bool is_new = slots.state(index) != SlotState::OCCUPIED;
+        slots.key(index) = key;
+        slots.value(index) = value;
+        if (is_new) {
+            slots.state(index) = SlotState::OCCUPIED;
+            current_size++;
+            if (filter) {
+                filter->insert(hash);
             }
         }
     }
 
+    /**
+     * @brief The single-probe core of the upsert-style operations: hashes the key once,
+     * runs one probe sequence, and fills the slot in place if the key is absent.
+     * @param make_value Called only when the key is inserted; returns its value.
+     * @return The slot index holding the key, and whether it was inserted by this call.
+     */
+    template<typename KK, typename MakeValue>
+    std::pair<size_t, bool> find_or_create(KK&& key, MakeValue&& make_value) {
+        if (static_cast<float>(current_size) / slot_count >= 0.7f) {
+            resize_and_rehash();
+        }
+
+        size_t hash = hash_function(key);
+        size_t index = find_slot_from(hash % slot_count, key);
+        if (slots.state(index) == SlotState::OCCUPIED) {
+            return {index, false};
+        }
+
+        slots.key(index) = std::forward<KK>(key);
+        slots.value(index) = make_value();
+        slots.state(index) = SlotState::OCCUPIED;
+        current_size++;
+        if (filter) {
+            filter->insert(hash);
+        }
+        return {index, true};
+    }
+
 public:
+    using key_type = K;
+    using mapped_type = V;
+
     explicit HashTableOA(size_t initial_capacity = 16) : current_size(0) {
         if (initial_capacity == 0) initial_capacity = 16;
-        table.resize(initial_capacity);
+        slots.allocate(initial_capacity);
+        slot_count = initial_capacity;
     }
     
-    ~HashTableOA() = default; // No raw pointers, default destructor is fine.
+    ~HashTableOA() = default; // `slots` and `mapping` clean up after themselves.
 
     // Disallow copying and moving for simplicity in this example.
     HashTableOA(const HashTableOA&) = delete;
@@ -94,20 +533,87 @@ public:
      */
     void insert(const K& key, const V& value) {
         // Resize if the load factor (including DELETED slots as "used") is too high.
-        if (static_cast<float>(current_size) / table.size() >= 0.7f) {
+        if (static_cast<float>(current_size) / slot_count >= 0.7f) {
             resize_and_rehash();
         }
 
-        size_t index = find_slot(key);
-        
-        // If the slot is not currently occupied, it's a new element.
-        if (table[index].state != SlotState::OCCUPIED) {
-            current_size++;
+        size_t hash = hash_function(key);
+        store_at(find_slot_from(hash % slot_count, key), hash, key, value);
+    }
+
+    // --- Single-Probe Access ---
+    // Each of these hashes the key once and runs one probe sequence. Keys and values
+    // passed as rvalues are moved into the table. Returned pointers stay valid until
+    // the table is next modified.
+
+    /**
+     * @brief Finds the value stored for a key.
+     * @return A pointer to the stored value, or nullptr if the key is absent.
+     */
+    V* find(const K& key) {
+        size_t index = lookup_slot(key);
+        return index != NO_SLOT && slots.state(index) == SlotState::OCCUPIED ? &slots.value(index) : nullptr;
+    }
+
+    const V* find(const K& key) const {
+        size_t index = lookup_slot(key);
+        return index != NO_SLOT && slots.state(index) == SlotState::OCCUPIED ? &slots.value(index) : nullptr;
+    }
+
+    /**
+     * @brief Inserts a value constructed from `args` only if the key is absent.
+     * Nothing is constructed or moved from when the key already exists.
+     * @return The stored value and whether it was inserted.
+     */
+    template<typename... Args>
+    std::pair<V*, bool> try_emplace(const K& key, Args&&... args) {
+        auto result = find_or_create(key, [&] { return V(std::forward<Args>(args)...); });
+        return {&slots.value(result.first), result.second};
+    }
+
+    template<typename... Args>
+    std::pair<V*, bool> try_emplace(K&& key, Args&&... args) {
+        auto result = find_or_create(std::move(key), [&] { return V(std::forward<Args>(args)...); });
+        return {&slots.value(result.first), result.second};
+    }
+
+    /**
+     * @brief Inserts the key or overwrites its value.
+     * @return true if the key was inserted, false if an existing value was assigned.
+     */
+    template<typename KK, typename M>
+    bool insert_or_assign(KK&& key, M&& value) {
+        auto result = find_or_create(std::forward<KK>(key), [&] { return V(std::forward<M>(value)); });
+        if (!result.second) {
+            slots.value(result.first) = std::forward<M>(value);
         }
-        
-        table[index].key = key;
-        table[index].value = value;
-        table[index].state = SlotState::OCCUPIED;
+        return result.second;
+    }
+
+    /**
+     * @brief Returns the value for a key, inserting a default-constructed one if absent.
+     */
+    V& operator[](const K& key) {
+        return *try_emplace(key).first;
+    }
+
+    V& operator[](K&& key) {
+        return *try_emplace(std::move(key)).first;
+    }
+
+    /**
+     * @brief Inserts `init` if the key is absent; otherwise merges it into the stored
+     * value in place with `merge_fn(V& stored, const V& init)`.
+     * Typical use is aggregation, e.g. upsert(word, 1, [](int& n, int one) { n += one; }).
+     * @return true if the key was inserted.
+     */
+    template<typename KK, typename Init, typename MergeFn>
+    bool upsert(KK&& key, Init&& init, MergeFn&& merge_fn) {
+        auto result = find_or_create(std::forward<KK>(key), [&] { return V(std::forward<Init>(init)); });
+        if (!result.second) {
+            merge_fn(slots.value(result.first), init);
+        }
+        return result.second;
     }
 
     /**
@@ -115,9 +621,9 @@ public:
      * @return An std::optional<V> containing the value if found, otherwise empty.
      */
     std::optional<V> search(const K& key) const {
-        size_t index = find_slot(key);
-        if (table[index].state == SlotState::OCCUPIED && table[index].key == key) {
-            return table[index].value;
+        size_t index = lookup_slot(key);
+        if (index != NO_SLOT && slots.state(index) == SlotState::OCCUPIED && slots.key(index) == key) {
+            return slots.value(index);
         }
         return std::nullopt; // Key not found
     }
@@ -127,23 +633,383 @@ public:
      */
     bool remove(const K& key) {
         size_t index = find_slot(key);
-        if (table[index].state == SlotState::OCCUPIED && table[index].key == key) {
-            table[index].state = SlotState::DELETED;
+        if (slots.state(index) == SlotState::OCCUPIED && slots.key(index) == key) {
+            slots.state(index) = SlotState::DELETED;
             current_size--; // We reduce the count of occupied slots
             return true;
         }
         return false;
     }
 
+    // --- Batched Operations ---
+    // These hash every key up front and then resolve them in a second pass while
+    // prefetching the home slots of keys further down the batch, so the cache misses
+    // of independent probes overlap instead of being paid one after another.
+
+    /**
+     * @brief Looks up many keys at once.
+     * @param keys The keys to look up.
+     * @param out Resized to keys.size(); out[i] holds the value of keys[i] if it was found.
+     * @return The number of keys found.
+     */
+    size_t search_batch(const std::vector<K>& keys, std::vector<std::optional<V>>& out) const {
+        std::vector<size_t> indices = home_indices(keys);
+        out.assign(keys.size(), std::nullopt);
+
+        size_t found = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            prefetch_ahead(indices, i);
+            if (indices[i] == NO_SLOT) {
+                continue;
+            }
+            size_t index = find_slot_from(indices[i], keys[i]);
+            if (slots.state(index) == SlotState::OCCUPIED) {
+                out[i] = slots.value(index);
+                found++;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Checks many keys for membership at once.
+     * @param out Resized to keys.size(); out[i] is true if keys[i] is in the table.
+     * @return The number of keys found.
+     */
+    size_t contains_batch(const std::vector<K>& keys, std::vector<bool>& out) const {
+        std::vector<size_t> indices = home_indices(keys);
+        out.assign(keys.size(), false);
+
+        size_t found = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            prefetch_ahead(indices, i);
+            if (indices[i] != NO_SLOT && slots.state(find_slot_from(indices[i], keys[i])) == SlotState::OCCUPIED) {
+                out[i] = true;
+                found++;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Inserts or updates many key-value pairs at once.
+     * The table is grown once up front for the whole batch, so home indices stay
+     * valid while the batch is being applied.
+     */
+    void insert_batch(const std::vector<std::pair<K, V>>& entries) {
+        size_t new_capacity = capacity_for(current_size + entries.size());
+        if (new_capacity != slot_count) {
+            std::cout << "[INFO] Batch exceeds load factor. Resizing from " << slot_count
+                      << " to " << new_capacity << " slots." << std::endl;
+            rehash_into(new_capacity, 1);
+        }
+
+        std::vector<size_t> hashes(entries.size());
+        std::vector<size_t> indices(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i) {
+            hashes[i] = hash_function(entries[i].first);
+            indices[i] = hashes[i] % slot_count;
+        }
+
+        for (size_t i = 0; i < entries.size(); ++i) {
+            prefetch_ahead(indices, i);
+            store_at(find_slot_from(indices[i], entries[i].first), hashes[i], entries[i].first, entries[i].second);
+        }
+    }
+
+    // --- Snapshots ---
+
+    /**
+     * @brief Writes the table to a binary snapshot file: a header followed by the raw slot
+     * array (Interleaved) or the state, key and value arrays (Split), each padded to 64 bytes.
+     * Only available when both K and V are trivially copyable.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    void save(const std::string& path) const {
+        static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+                      "Snapshots require trivially copyable keys and values.");
+
+        SnapshotHeader header{};
+        std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+        header.version = SNAPSHOT_VERSION;
+        header.slot_size = static_cast<uint32_t>(Slots::bytes_per_slot());
+        header.capacity = slot_count;
+        header.size = current_size;
+        header.hasher_fingerprint = hasher_fingerprint();
+        header.layout = static_cast<uint32_t>(Layout);
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        slots.write(out, slot_count);
+        if (!out) {
+            throw std::runtime_error("Failed to write hash table snapshot: " + path);
+        }
+    }
+
+#ifdef HASH_TABLE_OA_HAS_MMAP
+    /**
+     * @brief Replaces the contents of the table with a snapshot written by save(),
+     * serving lookups straight from a memory mapping of the file without rebuilding.
+     *
+     * The mapping is private and copy-on-write: insert() and remove() may be used
+     * afterwards, and the kernel copies only the pages they touch. The file itself is
+     * never modified. The first resize copies the slots into ordinary heap storage.
+     * @throws std::runtime_error if the file is missing, truncated or incompatible.
+     */
+    void open_mapped(const std::string& path) {
+        static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+                      "Snapshots require trivially copyable keys and values.");
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open hash table snapshot: " + path);
+        }
+        struct stat file_info;
+        if (fstat(fd, &file_info) != 0 || static_cast<size_t>(file_info.st_size) < sizeof(SnapshotHeader)) {
+            ::close(fd);
+            throw std::runtime_error("Hash table snapshot is truncated: " + path);
+        }
+        size_t length = static_cast<size_t>(file_info.st_size);
+        void* address = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd); // The mapping keeps its own reference to the file.
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("Cannot map hash table snapshot: " + path);
+        }
+        auto new_mapping = std::make_unique<Mapping>(address, length);
+
+        const SnapshotHeader* header = static_cast<const SnapshotHeader*>(address);
+        if (std::memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 ||
+            header->version != SNAPSHOT_VERSION || header->slot_size != Slots::bytes_per_slot() ||
+            header->layout != static_cast<uint32_t>(Layout)) {
+            throw std::runtime_error("Not a compatible hash table snapshot: " + path);
+        }
+        if (header->hasher_fingerprint != hasher_fingerprint()) {
+            throw std::runtime_error("Hash table snapshot was written with a different hash function: " + path);
+        }
+        // Every slot occupies at least bytes_per_slot() bytes of the file, so bounding the
+        // capacity by the file length first keeps snapshot_bytes() from overflowing.
+        if (header->capacity == 0 || header->capacity > length / Slots::bytes_per_slot() ||
+            length < sizeof(SnapshotHeader) + Slots::snapshot_bytes(header->capacity)) {
+            throw std::runtime_error("Hash table snapshot is truncated: " + path);
+        }
+        // Probing stops at an EMPTY slot, and a saved table always keeps some free.
+        if (header->size >= header->capacity) {
+            throw std::runtime_error("Hash table snapshot is corrupt (size exceeds capacity): " + path);
+        }
+
+        char* regions = static_cast<char*>(address) + sizeof(SnapshotHeader);
+        if constexpr (SPLIT) {
+            slots.bind(regions, header->capacity);
+        } else {
+            slots.bind(regions);
+        }
+        mapping = std::move(new_mapping);
+        slot_count = header->capacity;
+        current_size = header->size;
+        if (filter) {
+            rebuild_filter();
+        }
+    }
+
+    /**
+     * @brief Returns true while the table is served from a mapped snapshot file.
+     */
+    bool is_mapped() const { return mapping != nullptr; }
+#endif
+
+    /**
+     * @brief Reports load, tombstones, probe-length distribution, resize history and memory use.
+     * Scans every slot once, so it costs O(capacity), but never prints or allocates per entry.
+     */
+    HashTableStats stats() const {
+        HashTableStats result;
+        result.size = current_size;
+        result.capacity = slot_count;
+        result.load_factor = static_cast<double>(current_size) / slot_count;
+        result.resize_count = resize_count;
+        result.rehash_ms = rehash_ms;
+
+        for (size_t i = 0; i < slot_count; ++i) {
+            if (slots.state(i) == SlotState::DELETED) {
+                result.tombstones++;
+            } else if (slots.state(i) == SlotState::OCCUPIED) {
+                size_t home = hash_function(slots.key(i)) % slot_count;
+                size_t displacement = (i + slot_count - home) % slot_count;
+                result.add_to_histogram(displacement);
+                result.max_displacement = std::max(result.max_displacement, displacement);
+            }
+        }
+
+        // Every slot reserves room for a key and a value; the state byte and padding are metadata.
+        result.memory.metadata = slot_count * Slots::metadata_per_slot();
+        result.memory.keys = slot_count * sizeof(K);
+        result.memory.values = slot_count * sizeof(V);
+        if (mapping) {
+            result.memory.metadata += sizeof(SnapshotHeader);
+        } else {
+            result.memory.allocator_overhead = slots.owned_bytes() - slot_count * Slots::bytes_per_slot()
+                                             + malloc_overhead(slots.owned_bytes());
+        }
+        if (filter) {
+            result.memory.metadata += filter->memory_bytes();
+        }
+
+        probe_counter.fill(result);
+        return result;
+    }
+
+    // --- Bulk Build and Rehash ---
+
+    /**
+     * @brief Rebuilds the slot array with `slot_count` slots, raised if needed so that
+     * the current entries stay below the maximum load factor. Drops all tombstones.
+     * @param threads Threads to move entries with; 0 uses every hardware thread.
+     */
+    void rehash(size_t new_slot_count, unsigned threads = 1) {
+        if (threads == 0) threads = ParallelBuild::default_threads();
+        new_slot_count = std::max(new_slot_count, static_cast<size_t>(1));
+        while (static_cast<float>(current_size) / new_slot_count >= 0.7f) {
+            new_slot_count *= 2;
+        }
+        rehash_into(new_slot_count, threads);
+    }
+
+    /**
+     * @brief Grows the table once so that `entries` entries fit without further resizes.
+     * @param threads Threads to move entries with; 0 uses every hardware thread.
+     */
+    void reserve(size_t entries, unsigned threads = 1) {
+        if (threads == 0) threads = ParallelBuild::default_threads();
+        size_t new_slot_count = capacity_for(entries);
+        if (new_slot_count != slot_count) {
+            rehash_into(new_slot_count, threads);
+        }
+    }
+
+    /**
+     * @brief Inserts or updates every pair of a random-access range of (key, value)
+     * pairs using several threads.
+     *
+     * The table is presized once; keys are hashed in parallel and partitioned by the
+     * region of the slot array their home slot falls in. Each thread probes and writes
+     * only inside its own region, so no locks are needed; the few entries whose probe
+     * sequence would leave their region are inserted serially at the end. When a key
+     * occurs more than once, the last occurrence wins, as with repeated insert().
+     * If copying an entry throws, the entries already stored stay in the table, are
+     * counted by size(), and the exception is rethrown.
+     * @param threads Threads to use; 0 uses every hardware thread.
+     */
+    template<typename Range>
+    void build_from(const Range& entries, unsigned threads = 0) {
+        if (threads == 0) threads = ParallelBuild::default_threads();
+        size_t count = entries.size();
+        reserve(current_size + count, threads);
+
+        std::vector<size_t> hashes(count);
+        ParallelBuild::run(threads, [&](unsigned t) {
+            auto range = ParallelBuild::chunk(count, threads, t);
+            for (size_t i = range.first; i < range.second; ++i) {
+                hashes[i] = hash_function(entries[i].first);
+            }
+        });
+        auto parts = ParallelBuild::partition_indices(count, threads, threads, [&](size_t i) {
+            return region_of(hashes[i] % slot_count, threads);
+        });
+
+        std::vector<size_t> inserted(threads, 0);
+        std::vector<std::vector<size_t>> overflow(threads);
+
+        // Runs even if a partition threw: whatever the threads stored is accounted for.
+        // The filter gets every hash, including those of overflow entries stored below.
+        auto commit = [&] {
+            for (size_t n : inserted) {
+                current_size += n;
+            }
+            if (filter) {
+                for (size_t hash : hashes) {
+                    filter->insert(hash);
+                }
+            }
+        };
+
+        try {
+            ParallelBuild::run(threads, [&](unsigned t) {
+                size_t region_end = ParallelBuild::chunk(slot_count, threads, t).second;
+                size_t stored = 0;
+                try {
+                    for (size_t k = parts.offsets[t]; k < parts.offsets[t + 1]; ++k) {
+                        size_t i = parts.order[k];
+                        const auto& entry = entries[i];
+
+                        // Linear probing as in find_slot_from, but stopping at the region end.
+                        size_t index = hashes[i] % slot_count;
+                        while (index < region_end && slots.state(index) != SlotState::EMPTY) {
+                            if (slots.state(index) == SlotState::OCCUPIED && slots.key(index) == entry.first) {
+                                break;
+                            }
+                            index++;
+                        }
+                        if (index == region_end) {
+                            overflow[t].push_back(i);
+                            continue;
+                        }
+
+                        if (slots.state(index) != SlotState::OCCUPIED) {
+                            slots.key(index) = entry.first;
+                            slots.state(index) = SlotState::OCCUPIED;
+                            stored++;
+                        }
+                        slots.value(index) = entry.second;
+                    }
+                } catch (...) {
+                    inserted[t] = stored;
+                    throw;
+                }
+                inserted[t] = stored;
+            });
+        } catch (...) {
+            commit();
+            throw;
+        }
+        commit();
+
+        // Overflow lists keep input order within a region, so later duplicates still win.
+        // store_at() keeps the size accurate by itself if a copy throws here.
+        for (const auto& part : overflow) {
+            for (size_t i : part) {
+                store_at(find_slot_from(hashes[i] % slot_count, entries[i].first), hashes[i], entries[i].first,
+                         entries[i].second);
+            }
+        }
+    }
+
+    // --- Bloom Filter Front-End ---
+
+    /**
+     * @brief Puts a blocked Bloom filter in front of every lookup, so that most lookups
+     * of absent keys are answered from one cache line instead of a probe sequence.
+     * Inserts keep it up to date and resizes rebuild it. Removed keys stay in the
+     * filter (raising the false-positive rate slightly) until the next resize.
+     * A mapped snapshot rebuilds the filter when it is opened.
+     * @param bits_per_key Filter bits per entry at the maximum load factor.
+     */
+    void enable_bloom_filter(double bits_per_key = 10.0) {
+        filter = std::make_unique<BlockedBloomFilter>(0, bits_per_key);
+        rebuild_filter();
+    }
+
+    void disable_bloom_filter() { filter.reset(); }
+    bool has_bloom_filter() const { return filter != nullptr; }
+
     size_t size() const { return current_size; }
     bool empty() const { return current_size == 0; }
 
     void print() const {
         std::cout << "--- Hash Table (Open Addressing) ---" << std::endl;
-        std::cout << "Size: " << current_size << ", Capacity: " << table.size() << std::endl;
-        for (size_t i = 0; i < table.size(); ++i) {
+        std::cout << "Size: " << current_size << ", Capacity: " << slot_count << std::endl;
+        for (size_t i = 0; i < slot_count; ++i) {
             std::cout << "Slot " << i << ": ";
-            switch (table[i].state) {
+            switch (slots.state(i)) {
                 case SlotState::EMPTY:
                     std::cout << "[EMPTY]";
                     break;
@@ -151,7 +1017,7 @@ public:
                     std::cout << "[DELETED]";
                     break;
                 case SlotState::OCCUPIED:
-                    std::cout << "[\"" << table[i].key << "\": " << table[i].value << "]";
+                    std::cout << "[\"" << slots.key(i) << "\": " << slots.value(i) << "]";
                     break;
             }
             std::cout << std::endl;
@@ -45,5 +45,8 @@ int main() {
     student_scores.insert("Eve", 68);
     student_scores.print();
 
+    std::cout << "\n--- Table Statistics ---" << std::endl;
+    std::cout << student_scores.stats();
+
     return 0;
 }
\ No newline at end of file
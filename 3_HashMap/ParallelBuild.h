@@ -0,0 +1,132 @@
+#ifndef HASH_TABLE_PARALLEL_BUILD_H
+#define HASH_TABLE_PARALLEL_BUILD_H
+
+#include <vector>
+#include <thread>
+#include <cstddef>
+#include <exception>
+#include <algorithm>
+
+namespace CustomDataStructures {
+
+/**
+ * @brief Helpers shared by the parallel bulk-build and rehash paths of the hash tables.
+ *
+ * The tables parallelize by partitioning work on the destination bucket/slot range:
+ * each thread owns a disjoint slice of the table, so no locks are needed while
+ * filling it.
+ */
+namespace ParallelBuild {
+
+/**
+ * @brief Number of threads to use when the caller passes 0.
+ */
+inline unsigned default_threads() {
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : hardware;
+}
+
+/**
+ * @brief Runs `fn(thread_index)` on `threads` threads (the calling thread is index 0)
+ * and waits for all of them.
+ * @throws The exception thrown by the lowest-indexed failing thread (or by thread
+ * creation), rethrown on the calling thread once every started thread has finished.
+ */
+template<typename Fn>
+void run(unsigned threads, Fn&& fn) {
+    std::vector<std::exception_ptr> errors(threads > 0 ? threads : 1);
+    std::vector<std::thread> workers;
+    try {
+        workers.reserve(threads > 0 ? threads - 1 : 0);
+        for (unsigned t = 1; t < threads; ++t) {
+            workers.emplace_back([&fn, &errors, t] {
+                try {
+                    fn(t);
+                } catch (...) {
+                    errors[t] = std::current_exception();
+                }
+            });
+        }
+        fn(0);
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+/**
+ * @brief Returns the half-open range [begin, end) of `count` items handled by one of `parts` parts.
+ */
+inline std::pair<size_t, size_t> chunk(size_t count, unsigned parts, unsigned part) {
+    return {count * part / parts, count * (part + 1) / parts};
+}
+
+/**
+ * @brief Item indices grouped by partition: the items of partition p are
+ * order[offsets[p]] .. order[offsets[p + 1] - 1], in their original relative order.
+ */
+struct Partitioning {
+    std::vector<size_t> order;
+    std::vector<size_t> offsets;
+};
+
+/**
+ * @brief A parallel, stable counting sort of item indices by partition.
+ * @param count Number of items.
+ * @param partitions Number of partitions.
+ * @param partition_of Maps an item index to its partition; items mapped to
+ * `partitions` or above are skipped.
+ */
+template<typename PartitionOf>
+Partitioning partition_indices(size_t count, unsigned partitions, unsigned threads, PartitionOf partition_of) {
+    // counts[t * (partitions + 1) + p]: items of thread t's chunk that fall into partition p.
+    std::vector<size_t> counts(static_cast<size_t>(threads) * (partitions + 1), 0);
+    run(threads, [&](unsigned t) {
+        auto range = chunk(count, threads, t);
+        size_t* thread_counts = &counts[static_cast<size_t>(t) * (partitions + 1)];
+        for (size_t i = range.first; i < range.second; ++i) {
+            thread_counts[std::min<size_t>(partition_of(i), partitions)]++;
+        }
+    });
+
+    // Turn counts into write cursors: partition-major, then thread order, keeps the sort stable.
+    Partitioning result;
+    result.offsets.assign(partitions + 1, 0);
+    size_t total = 0;
+    for (unsigned p = 0; p < partitions; ++p) {
+        result.offsets[p] = total;
+        for (unsigned t = 0; t < threads; ++t) {
+            size_t& slot = counts[static_cast<size_t>(t) * (partitions + 1) + p];
+            size_t items = slot;
+            slot = total;
+            total += items;
+        }
+    }
+    result.offsets[partitions] = total;
+    result.order.resize(total);
+
+    run(threads, [&](unsigned t) {
+        auto range = chunk(count, threads, t);
+        size_t* cursors = &counts[static_cast<size_t>(t) * (partitions + 1)];
+        for (size_t i = range.first; i < range.second; ++i) {
+            size_t p = partition_of(i);
+            if (p < partitions) {
+                result.order[cursors[p]++] = i;
+            }
+        }
+    });
+    return result;
+}
+
+} // namespace ParallelBuild
+
+} // namespace CustomDataStructures
+
+#endif // HASH_TABLE_PARALLEL_BUILD_H
@@ -0,0 +1,289 @@
+#ifndef STATIC_PERFECT_HASH_MAP_H
+#define STATIC_PERFECT_HASH_MAP_H
+
+#include <array>
+#include <utility>
+#include <optional>
+#include <string_view>
+#include <stdexcept>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace CustomDataStructures {
+
+/**
+ * @brief Seeded hash functions usable in constant expressions, for
+ * StaticPerfectHashMap. Defined for integral types, enums and std::string_view;
+ * specialize it to support other key types.
+ */
+template<typename K, typename Enable = void>
+struct StaticHash;
+
+// Finalizer shared by the StaticHash specializations (MurmurHash3's fmix64).
+constexpr uint64_t static_hash_mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+template<typename K>
+struct StaticHash<K, typename std::enable_if<std::is_integral<K>::value || std::is_enum<K>::value>::type> {
+    constexpr uint64_t operator()(K key, uint64_t seed) const {
+        return static_hash_mix(static_cast<uint64_t>(key) ^ static_hash_mix(seed));
+    }
+};
+
+template<>
+struct StaticHash<std::string_view> {
+    // Words are assembled from bytes with shifts, which works in constant
+    // expressions; the loads are spelled out so that the compiler can merge them
+    // into plain 8- and 4-byte loads at run time.
+    static constexpr uint64_t byte(const char* p) {
+        return static_cast<unsigned char>(*p);
+    }
+
+    static constexpr uint64_t load4(const char* p) {
+        return byte(p) | byte(p + 1) << 8 | byte(p + 2) << 16 | byte(p + 3) << 24;
+    }
+
+    static constexpr uint64_t load8(const char* p) {
+        return byte(p) | byte(p + 1) << 8 | byte(p + 2) << 16 | byte(p + 3) << 24
+             | byte(p + 4) << 32 | byte(p + 5) << 40 | byte(p + 6) << 48 | byte(p + 7) << 56;
+    }
+
+    // Consumes eight bytes per step. The last, possibly partial, word is read as an
+    // overlapping full load, so short keys never take a byte loop.
+    constexpr uint64_t operator()(std::string_view key, uint64_t seed) const {
+        const char* p = key.data();
+        size_t size = key.size();
+        uint64_t h = seed ^ (size * 0x9E3779B97F4A7C15ULL);
+        uint64_t last = 0;
+        if (size >= 8) {
+            for (size_t at = 0; at + 8 < size; at += 8) {
+                h = (h ^ load8(p + at)) * 0x9E3779B97F4A7C15ULL;
+                h ^= h >> 29;
+            }
+            last = load8(p + size - 8);
+        } else if (size >= 4) {
+            last = load4(p) | load4(p + size - 4) << 32;
+        } else if (size > 0) {
+            last = byte(p) | byte(p + size / 2) << 8 | byte(p + size - 1) << 16;
+        }
+        return static_hash_mix(h ^ last);
+    }
+};
+
+/**
+ * @brief An immutable map over a fixed set of keys, built into a collision-free
+ * table without any allocation, usually at compile time.
+ *
+ * Construction follows PTHash: keys are hashed into small buckets, and for each
+ * bucket, largest first, a 16-bit "pilot" is searched so that every key in the
+ * bucket lands on a distinct free slot. A lookup therefore costs one hash, one
+ * pilot read and one slot read with a single key comparison, and never probes.
+ *
+ * Declare the map `constexpr` (or `static constexpr`) to build it during
+ * compilation; building a few thousand keys stays within the compilers' default
+ * constant-evaluation limits. Unused slots hold a copy of the first entry, which
+ * can never be the answer for any other key, so no occupancy bits are needed.
+ *
+ * Example:
+ *     constexpr std::array<std::pair<std::string_view, int>, 2> methods{{{"GET", 1}, {"POST", 2}}};
+ *     constexpr StaticPerfectHashMap table(methods);
+ *     static_assert(*table.find("POST") == 2);
+ *
+ * @tparam K The key type: literal, equality-comparable and hashable with Hash.
+ * Use std::string_view rather than std::string for text keys.
+ * @tparam V The value type. Must be a literal, default-constructible type for
+ * compile-time construction.
+ * @tparam N The number of entries.
+ * @tparam Hash A seeded hash, called as Hash{}(key, seed).
+ */
+template<typename K, typename V, size_t N, typename Hash = StaticHash<K>>
+class StaticPerfectHashMap {
+private:
+    // --- Private Inner Structures ---
+
+    static constexpr size_t BUCKETS = N / 4 + 1;      // About four keys per bucket
+    static constexpr size_t SLOTS = N + N / 4 + 1;    // Load factor of about 0.8
+    static constexpr uint32_t MAX_PILOT = 0xFFFF;     // Pilots are stored in 16 bits
+    static constexpr uint64_t MAX_SEEDS = 16;         // Global seeds tried before giving up
+
+    // Key and value side by side, so that a lookup touches one slot.
+    struct Slot {
+        K key{};
+        V value{};
+    };
+
+    // --- Member Variables ---
+
+    uint64_t seed = 0;
+    std::array<uint16_t, BUCKETS> pilots{};
+    std::array<Slot, SLOTS> slots{};
+
+    static constexpr size_t bucket_of(uint64_t hash) {
+        return static_cast<size_t>((hash >> 32) % BUCKETS);
+    }
+
+    static constexpr size_t position(uint64_t hash, uint32_t pilot) {
+        return static_cast<size_t>((hash ^ static_hash_mix(pilot)) % SLOTS);
+    }
+
+    /**
+     * @brief Tries to place every key with the current seed.
+     * @return False if some bucket found no pilot, in which case the caller
+     * retries with another seed.
+     */
+    constexpr bool try_build(const std::array<std::pair<K, V>, N>& entries) {
+        // Hash every key and group the keys by bucket (counting sort).
+        std::array<uint64_t, N> hashes{};
+        std::array<size_t, BUCKETS + 1> bucket_start{};
+        for (size_t i = 0; i < N; ++i) {
+            hashes[i] = Hash{}(entries[i].first, seed);
+            bucket_start[bucket_of(hashes[i]) + 1]++;
+        }
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            bucket_start[b + 1] += bucket_start[b];
+        }
+        std::array<size_t, N> keys_by_bucket{};
+        std::array<size_t, BUCKETS> fill{};
+        for (size_t i = 0; i < N; ++i) {
+            size_t b = bucket_of(hashes[i]);
+            keys_by_bucket[bucket_start[b] + fill[b]++] = i;
+        }
+
+        // Visit the buckets from largest to smallest (counting sort by size),
+        // while most slots are still free.
+        std::array<size_t, N + 2> size_start{};
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            size_start[N - (bucket_start[b + 1] - bucket_start[b]) + 1]++;
+        }
+        for (size_t s = 0; s <= N; ++s) {
+            size_start[s + 1] += size_start[s];
+        }
+        std::array<size_t, BUCKETS> bucket_order{};
+        for (size_t b = 0; b < BUCKETS; ++b) {
+            bucket_order[size_start[N - (bucket_start[b + 1] - bucket_start[b])]++] = b;
+        }
+
+        std::array<bool, SLOTS> taken{};
+        std::array<size_t, N> slot_of{};
+        std::array<size_t, N> positions{};
+        for (size_t b : bucket_order) {
+            size_t first = bucket_start[b];
+            size_t count = bucket_start[b + 1] - first;
+            if (count == 0) {
+                break; // Every remaining bucket is empty too
+            }
+
+            // Two keys with the same full hash can never be separated by a pilot.
+            for (size_t x = first; x < first + count; ++x) {
+                for (size_t y = x + 1; y < first + count; ++y) {
+                    if (hashes[keys_by_bucket[x]] == hashes[keys_by_bucket[y]]) {
+                        if (entries[keys_by_bucket[x]].first == entries[keys_by_bucket[y]].first) {
+                            throw std::runtime_error("StaticPerfectHashMap: duplicate key.");
+                        }
+                        return false;
+                    }
+                }
+            }
+
+            bool placed = false;
+            for (uint32_t pilot = 0; pilot <= MAX_PILOT && !placed; ++pilot) {
+                placed = true;
+                for (size_t x = 0; x < count && placed; ++x) {
+                    positions[x] = position(hashes[keys_by_bucket[first + x]], pilot);
+                    placed = !taken[positions[x]];
+                    for (size_t y = 0; y < x && placed; ++y) {
+                        placed = positions[y] != positions[x];
+                    }
+                }
+                if (placed) {
+                    pilots[b] = static_cast<uint16_t>(pilot);
+                    for (size_t x = 0; x < count; ++x) {
+                        taken[positions[x]] = true;
+                        slot_of[keys_by_bucket[first + x]] = positions[x];
+                    }
+                }
+            }
+            if (!placed) {
+                return false;
+            }
+        }
+
+        for (size_t s = 0; s < SLOTS; ++s) {
+            slots[s].key = entries[0].first;
+            slots[s].value = entries[0].second;
+        }
+        for (size_t i = 0; i < N; ++i) {
+            slots[slot_of[i]].key = entries[i].first;
+            slots[slot_of[i]].value = entries[i].second;
+        }
+        return true;
+    }
+
+public:
+    /**
+     * @brief Builds the table. Throws std::runtime_error (a compile error when
+     * constant-evaluated) on duplicate keys, or if no seed yields a perfect hash.
+     */
+    constexpr explicit StaticPerfectHashMap(const std::array<std::pair<K, V>, N>& entries) {
+        if constexpr (N > 0) {
+            for (uint64_t attempt = 0; attempt < MAX_SEEDS; ++attempt) {
+                seed = static_hash_mix(attempt + 1);
+                pilots = {};
+                if (try_build(entries)) {
+                    return;
+                }
+            }
+            throw std::runtime_error("StaticPerfectHashMap: no perfect hash function found.");
+        }
+    }
+
+    // --- Lookup ---
+
+    /**
+     * @brief Looks up a key with a single slot probe.
+     * @return A pointer to the value, or nullptr if the key is not in the set.
+     */
+    constexpr const V* find(const K& key) const {
+        if constexpr (N == 0) {
+            (void)key;
+            return nullptr;
+        } else {
+            uint64_t hash = Hash{}(key, seed);
+            const Slot& slot = slots[position(hash, pilots[bucket_of(hash)])];
+            return slot.key == key ? &slot.value : nullptr;
+        }
+    }
+
+    /**
+     * @brief Searches for a key.
+     * @return An std::optional containing the value if found, otherwise std::nullopt.
+     */
+    constexpr std::optional<V> search(const K& key) const {
+        if (const V* value = find(key)) {
+            return *value;
+        }
+        return std::nullopt;
+    }
+
+    constexpr bool contains(const K& key) const { return find(key) != nullptr; }
+
+    constexpr size_t size() const { return N; }
+    constexpr bool empty() const { return N == 0; }
+    constexpr size_t capacity() const { return SLOTS; }
+
+    /**
+     * @brief Bytes used by the table: the pilots plus the slot array.
+     */
+    constexpr size_t memory_bytes() const { return sizeof(pilots) + sizeof(slots); }
+};
+
+} // namespace CustomDataStructures
+
+#endif // STATIC_PERFECT_HASH_MAP_H
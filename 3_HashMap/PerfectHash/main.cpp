@@ -0,0 +1,46 @@
+#include <iostream>
+#include <string_view>
+#include <array>
+#include <utility>
+#include "StaticPerfectHashMap.h"
+
+enum class Method { GET, HEAD, POST, PUT, DELETE, OPTIONS, PATCH };
+
+// Both tables are built by the compiler; nothing below runs a constructor at startup.
+constexpr std::array<std::pair<std::string_view, Method>, 7> METHOD_NAMES{{
+    {"GET", Method::GET}, {"HEAD", Method::HEAD}, {"POST", Method::POST}, {"PUT", Method::PUT},
+    {"DELETE", Method::DELETE}, {"OPTIONS", Method::OPTIONS}, {"PATCH", Method::PATCH},
+}};
+
+constexpr std::array<std::pair<Method, std::string_view>, 7> METHOD_STRINGS{{
+    {Method::GET, "GET"}, {Method::HEAD, "HEAD"}, {Method::POST, "POST"}, {Method::PUT, "PUT"},
+    {Method::DELETE, "DELETE"}, {Method::OPTIONS, "OPTIONS"}, {Method::PATCH, "PATCH"},
+}};
+
+int main() {
+    using CustomDataStructures::StaticPerfectHashMap;
+
+    static constexpr StaticPerfectHashMap parse_method(METHOD_NAMES);
+    static constexpr StaticPerfectHashMap method_name(METHOD_STRINGS);
+
+    // Lookups are constant expressions too.
+    static_assert(*parse_method.find("POST") == Method::POST);
+    static_assert(!parse_method.contains("TRACE"));
+    static_assert(*method_name.find(Method::PATCH) == "PATCH");
+
+    std::cout << "--- String to Enum ---" << std::endl;
+    for (std::string_view request : {"GET", "DELETE", "TRACE", "get"}) {
+        if (auto method = parse_method.search(request)) {
+            std::cout << request << " -> " << *method_name.find(*method) << " ("
+                      << static_cast<int>(*method) << ")" << std::endl;
+        } else {
+            std::cout << request << " -> not a method" << std::endl;
+        }
+    }
+
+    std::cout << "\n--- Table Layout ---" << std::endl;
+    std::cout << "Entries: " << parse_method.size() << ", Slots: " << parse_method.capacity()
+              << ", Bytes: " << parse_method.memory_bytes() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,497 @@
+#ifndef HASH_TABLE_STREAMING_LOADER_H
+#define HASH_TABLE_STREAMING_LOADER_H
+
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ParallelBuild.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HASH_TABLE_STREAMING_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CustomDataStructures {
+
+/**
+ * @brief Loads delimited key/value files (one `key<delimiter>value` record per line)
+ * into HashTable or HashTableOA through a three-stage pipeline:
+ *
+ *   reader  - maps the file (or, where mapping is unavailable, reads it in large
+ *             blocks) and cuts it into chunks that end on a line break;
+ *   parsers - worker threads split each chunk into string_view records without
+ *             copying, convert the values and build the owned keys;
+ *   inserter - the calling thread moves each parsed batch into the table.
+ *
+ * The tables are not thread-safe, so a single inserter applies the batches, in file
+ * order: when a key occurs more than once, the last occurrence wins, exactly as with
+ * a sequential insert() loop. The number of chunks between the reader and the
+ * inserter is capped, which bounds memory use to about
+ * `chunks_in_flight * chunk_bytes` plus the parsed records of those chunks.
+ */
+namespace StreamingLoad {
+
+struct Options {
+    char delimiter = '\t';
+    unsigned threads = 0;          // Parser threads; 0 uses every hardware thread but one
+    size_t chunk_bytes = 8 << 20;  // Target chunk size; chunks are extended to the next line break
+    size_t chunks_in_flight = 0;   // Chunks read but not yet inserted; 0 uses 2 * threads + 2
+    bool use_mmap = true;          // Map regular files instead of reading them
+    bool presize = true;           // Reserve the table once, from the distinct keys of the first chunk
+};
+
+struct Result {
+    size_t bytes = 0;      // Bytes of input consumed
+    size_t records = 0;    // Records inserted (including updates of repeated keys)
+    size_t malformed = 0;  // Non-empty lines without a delimiter or with an unparsable value
+    size_t chunks = 0;
+};
+
+/**
+ * @brief Default value parsers: strings are copied, numbers are read with
+ * std::from_chars and must span the whole field.
+ */
+inline bool parse_field(std::string_view text, std::string& out) {
+    out.assign(text.data(), text.size());
+    return true;
+}
+
+template<typename T>
+typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, bool>::type
+parse_field(std::string_view text, T& out) {
+    const char* end = text.data() + text.size();
+    auto result = std::from_chars(text.data(), end, out);
+    return result.ec == std::errc() && result.ptr == end;
+}
+
+/**
+ * @brief A contiguous run of whole lines. `text` points into the file mapping, or
+ * into `buffer` when the file is streamed.
+ */
+struct Chunk {
+    size_t index = 0;
+    std::string_view text;
+    std::unique_ptr<char[]> buffer;
+};
+
+template<typename K, typename V>
+struct Batch {
+    size_t index = 0;
+    size_t bytes = 0;
+    size_t malformed = 0;
+    std::vector<std::pair<K, V>> records;
+};
+
+#if HASH_TABLE_STREAMING_HAS_MMAP
+/**
+ * @brief A read-only mapping of a whole file, released on destruction.
+ */
+class MappedFile {
+private:
+    void* address = nullptr;
+    size_t length = 0;
+
+public:
+    /**
+     * @brief Maps `path` if it is a non-empty regular file; otherwise is_open() stays false.
+     */
+    explicit MappedFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat file_info;
+        if (fstat(fd, &file_info) == 0 && S_ISREG(file_info.st_mode) && file_info.st_size > 0) {
+            size_t size = static_cast<size_t>(file_info.st_size);
+            void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                address = mapped;
+                length = size;
+                madvise(address, length, MADV_SEQUENTIAL);
+            }
+        }
+        ::close(fd); // The mapping keeps its own reference to the file.
+    }
+
+    ~MappedFile() {
+        if (address != nullptr) {
+            munmap(address, length);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool is_open() const { return address != nullptr; }
+    const char* data() const { return static_cast<const char*>(address); }
+    size_t size() const { return length; }
+
+    /**
+     * @brief Asks the kernel to start reading [offset, offset + bytes) ahead of the parsers.
+     */
+    void prefetch(size_t offset, size_t bytes) const {
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t begin = offset / page * page;
+        madvise(static_cast<char*>(address) + begin, offset + bytes - begin, MADV_WILLNEED);
+    }
+};
+#endif
+
+/**
+ * @brief State shared by the three stages. One mutex guards everything: it is taken
+ * a few times per chunk of megabytes, never per record.
+ */
+template<typename K, typename V>
+class Pipeline {
+private:
+    std::mutex lock;
+    std::condition_variable changed;
+    std::deque<Chunk> chunks;
+    std::deque<Batch<K, V>> batches;
+    size_t chunks_read = 0;
+    size_t chunks_applied = 0;
+    size_t window;
+    unsigned parsers_running;
+    bool reading_done = false;
+    std::exception_ptr error;
+
+public:
+    Pipeline(size_t chunks_in_flight, unsigned parsers) : window(chunks_in_flight), parsers_running(parsers) {}
+
+    /**
+     * @brief Reader side: blocks while the window is full.
+     * @return false if the pipeline has failed and the chunk was dropped.
+     */
+    bool push_chunk(Chunk chunk) {
+        std::unique_lock<std::mutex> guard(lock);
+        changed.wait(guard, [&] { return error || chunks_read - chunks_applied < window; });
+        if (error) return false;
+        chunk.index = chunks_read++;
+        chunks.push_back(std::move(chunk));
+        changed.notify_all();
+        return true;
+    }
+
+    void finish_reading() {
+        std::lock_guard<std::mutex> guard(lock);
+        reading_done = true;
+        changed.notify_all();
+    }
+
+    /**
+     * @brief Parser side: blocks until a chunk is available.
+     * @return false once every chunk has been taken or the pipeline has failed.
+     */
+    bool pop_chunk(Chunk& chunk) {
+        std::unique_lock<std::mutex> guard(lock);
+        changed.wait(guard, [&] { return error || !chunks.empty() || reading_done; });
+        if (error || chunks.empty()) return false;
+        chunk = std::move(chunks.front());
+        chunks.pop_front();
+        return true;
+    }
+
+    void push_batch(Batch<K, V> batch) {
+        std::lock_guard<std::mutex> guard(lock);
+        batches.push_back(std::move(batch));
+        changed.notify_all();
+    }
+
+    void parser_done() {
+        std::lock_guard<std::mutex> guard(lock);
+        parsers_running--;
+        changed.notify_all();
+    }
+
+    /**
+     * @brief Inserter side: moves every parsed batch into `ready`, blocking until there is one.
+     * @return false once all parsers have finished and nothing is left, or on failure.
+     */
+    bool pop_batches(std::map<size_t, Batch<K, V>>& ready) {
+        std::unique_lock<std::mutex> guard(lock);
+        changed.wait(guard, [&] { return error || !batches.empty() || parsers_running == 0; });
+        if (error || batches.empty()) return false;
+        while (!batches.empty()) {
+            size_t index = batches.front().index;
+            ready.emplace(index, std::move(batches.front()));
+            batches.pop_front();
+        }
+        return true;
+    }
+
+    void batch_applied() {
+        std::lock_guard<std::mutex> guard(lock);
+        chunks_applied++;
+        changed.notify_all();
+    }
+
+    /**
+     * @brief Records the first failure and wakes every stage so it can stop.
+     */
+    void fail(std::exception_ptr failure) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (!error) error = failure;
+        changed.notify_all();
+    }
+
+    std::exception_ptr failure() {
+        std::lock_guard<std::mutex> guard(lock);
+        return error;
+    }
+};
+
+/**
+ * @brief Splits one chunk into records. Keys and values are string_views into the
+ * chunk until they are converted; a trailing '\r' is dropped and empty lines are skipped.
+ */
+template<typename K, typename V, typename ParseValue>
+Batch<K, V> parse_chunk(const Chunk& chunk, char delimiter, ParseValue& parse_value) {
+    Batch<K, V> batch;
+    batch.index = chunk.index;
+    batch.bytes = chunk.text.size();
+
+    const char* position = chunk.text.data();
+    const char* end = position + chunk.text.size();
+    while (position < end) {
+        const char* line_break = static_cast<const char*>(std::memchr(position, '\n', end - position));
+        const char* line_end = line_break != nullptr ? line_break : end;
+        std::string_view line(position, line_end - position);
+        position = line_break != nullptr ? line_break + 1 : end;
+
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        if (line.empty()) continue;
+        size_t split = line.find(delimiter);
+        V value{};
+        if (split == std::string_view::npos || !parse_value(line.substr(split + 1), value)) {
+            batch.malformed++;
+            continue;
+        }
+        batch.records.emplace_back(K(line.substr(0, split)), std::move(value));
+    }
+    return batch;
+}
+
+/**
+ * @brief The last '\n' in [data, data + length), or nullptr.
+ */
+inline const char* last_line_break(const char* data, size_t length) {
+    for (size_t i = length; i > 0; --i) {
+        if (data[i - 1] == '\n') return data + i - 1;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Streams a file in blocks of about `chunk_bytes`. The partial line at the
+ * end of each block is carried over to the next one.
+ */
+template<typename K, typename V>
+void read_blocks(const std::string& path, size_t chunk_bytes, Pipeline<K, V>& pipeline) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open key/value file: " + path);
+    }
+    std::string carry;
+    while (true) {
+        size_t kept = carry.size();
+        Chunk chunk;
+        chunk.buffer.reset(new char[kept + chunk_bytes]);
+        std::memcpy(chunk.buffer.get(), carry.data(), kept);
+        file.read(chunk.buffer.get() + kept, static_cast<std::streamsize>(chunk_bytes));
+        size_t length = kept + static_cast<size_t>(file.gcount());
+        if (file.bad()) {
+            throw std::runtime_error("Error reading key/value file: " + path);
+        }
+        bool at_end = file.eof();
+        carry.clear();
+
+        if (!at_end) {
+            const char* last_break = last_line_break(chunk.buffer.get(), length);
+            if (last_break == nullptr) {
+                carry.assign(chunk.buffer.get(), length); // A line longer than the block
+                continue;
+            }
+            size_t whole = static_cast<size_t>(last_break - chunk.buffer.get()) + 1;
+            carry.assign(chunk.buffer.get() + whole, length - whole);
+            length = whole;
+        }
+        if (length > 0) {
+            chunk.text = std::string_view(chunk.buffer.get(), length);
+            if (!pipeline.push_chunk(std::move(chunk))) return;
+        }
+        if (at_end) return;
+    }
+}
+
+/**
+ * @brief Loads `path` into `table`, converting each value with
+ * `parse_value(std::string_view field, V& out)`, which returns false to reject the record.
+ * It is called concurrently from every parser thread, so it must not mutate shared state.
+ * Keys are constructed from the key field's string_view, so K is typically std::string.
+ * @throws std::runtime_error if the file cannot be opened or read. An exception thrown
+ * by `parse_value` or by the table stops the pipeline and is rethrown here; records
+ * inserted before it stay in the table.
+ * @throws std::system_error if a reader or parser thread cannot be started.
+ */
+template<typename Table, typename ParseValue>
+Result load_file(Table& table, const std::string& path, ParseValue parse_value, const Options& options = Options()) {
+    using K = typename Table::key_type;
+    using V = typename Table::mapped_type;
+
+    unsigned parsers = options.threads;
+    if (parsers == 0) {
+        unsigned hardware = ParallelBuild::default_threads();
+        parsers = hardware > 1 ? hardware - 1 : 1;
+    }
+    size_t chunk_bytes = options.chunk_bytes > 0 ? options.chunk_bytes : 1;
+    size_t window = options.chunks_in_flight > 0 ? options.chunks_in_flight : 2 * parsers + 2;
+
+#if HASH_TABLE_STREAMING_HAS_MMAP
+    std::unique_ptr<MappedFile> mapping;
+    if (options.use_mmap) {
+        mapping = std::make_unique<MappedFile>(path);
+        if (!mapping->is_open()) mapping.reset(); // Empty, not a regular file, or unmappable: stream it
+    }
+#endif
+    // Only used to presize; stays 0 for pipes and other files without a known size.
+    size_t file_bytes = 0;
+    std::error_code size_error;
+    if (options.presize && std::filesystem::is_regular_file(path, size_error)) {
+        std::uintmax_t size = std::filesystem::file_size(path, size_error);
+        if (!size_error) file_bytes = static_cast<size_t>(size);
+    }
+
+    Pipeline<K, V> pipeline(window, parsers);
+    std::thread reader;
+    std::vector<std::thread> workers;
+    workers.reserve(parsers);
+
+    // If a thread cannot be started, the pipeline fails, the stages already running
+    // wind down, and the inserter below exits at once; the error is rethrown after
+    // the joins. Parsers that never started are marked done so nothing waits on them.
+    try {
+        reader = std::thread([&] {
+            try {
+#if HASH_TABLE_STREAMING_HAS_MMAP
+                if (mapping) {
+                    const char* data = mapping->data();
+                    size_t size = mapping->size();
+                    for (size_t begin = 0; begin < size;) {
+                        size_t end = std::min(size, begin + chunk_bytes);
+                        if (end < size) {
+                            const void* line_break = std::memchr(data + end, '\n', size - end);
+                            end = line_break != nullptr ? static_cast<const char*>(line_break) - data + 1 : size;
+                        }
+                        mapping->prefetch(begin, end - begin);
+                        Chunk chunk;
+                        chunk.text = std::string_view(data + begin, end - begin);
+                        if (!pipeline.push_chunk(std::move(chunk))) break;
+                        begin = end;
+                    }
+                } else
+#endif
+                {
+                    read_blocks(path, chunk_bytes, pipeline);
+                }
+            } catch (...) {
+                pipeline.fail(std::current_exception());
+            }
+            pipeline.finish_reading();
+        });
+
+        for (unsigned t = 0; t < parsers; ++t) {
+            workers.emplace_back([&] {
+                try {
+                    Chunk chunk;
+                    while (pipeline.pop_chunk(chunk)) {
+                        pipeline.push_batch(parse_chunk<K, V>(chunk, options.delimiter, parse_value));
+                        chunk = Chunk();
+                    }
+                } catch (...) {
+                    pipeline.fail(std::current_exception());
+                }
+                pipeline.parser_done();
+            });
+        }
+    } catch (...) {
+        pipeline.fail(std::current_exception());
+        for (size_t t = workers.size(); t < parsers; ++t) {
+            pipeline.parser_done();
+        }
+    }
+
+    // Inserter: apply batches strictly in file order, holding early arrivals back.
+    Result result;
+    try {
+        std::map<size_t, Batch<K, V>> ready;
+        size_t next = 0;
+        while (pipeline.pop_batches(ready)) {
+            for (auto it = ready.begin(); it != ready.end() && it->first == next; it = ready.erase(it), ++next) {
+                Batch<K, V>& batch = it->second;
+                size_t size_before = table.size();
+                for (auto& record : batch.records) {
+                    table.insert_or_assign(std::move(record.first), std::move(record.second));
+                }
+                // Extrapolate the keys the first chunk added, not its records: files that
+                // repeat a few keys must not reserve room for one entry per line.
+                if (next == 0 && file_bytes > batch.bytes && batch.bytes > 0) {
+                    size_t new_keys = table.size() - size_before;
+                    size_t estimate = static_cast<size_t>(
+                        static_cast<double>(new_keys) * (file_bytes - batch.bytes) / batch.bytes);
+                    table.reserve(table.size() + estimate, ParallelBuild::default_threads());
+                }
+                result.bytes += batch.bytes;
+                result.records += batch.records.size();
+                result.malformed += batch.malformed;
+                result.chunks++;
+                pipeline.batch_applied();
+            }
+        }
+    } catch (...) {
+        pipeline.fail(std::current_exception());
+    }
+
+    if (reader.joinable()) {
+        reader.join();
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    if (std::exception_ptr failure = pipeline.failure()) {
+        std::rethrow_exception(failure);
+    }
+    return result;
+}
+
+/**
+ * @brief Loads `path` into `table`, parsing values with parse_field().
+ */
+template<typename Table>
+Result load_file(Table& table, const std::string& path, const Options& options = Options()) {
+    using V = typename Table::mapped_type;
+    return load_file(table, path, [](std::string_view text, V& out) { return parse_field(text, out); }, options);
+}
+
+} // namespace StreamingLoad
+
+} // namespace CustomDataStructures
+
+#endif // HASH_TABLE_STREAMING_LOADER_H
@@ -0,0 +1,729 @@
+#ifndef CUSTOM_BTREE_MAP_H
+#define CUSTOM_BTREE_MAP_H
+
+#include <vector>
+#include <stdexcept>
+#include <iostream>
+#include <optional>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace CustomDataStructures {
+
+/**
+ * @brief An ordered map implemented as a B+tree with cache-sized nodes.
+ *
+ * Every node stores its keys in one contiguous array of about `NodeBytes` bytes,
+ * so descending one level costs a few adjacent cache lines instead of one pointer
+ * chase per comparison as in a red-black tree. All entries live in the leaves,
+ * which are linked left to right, so ordered iteration and range scans walk
+ * whole arrays. For 4- and 8-byte integer keys, the in-node search counts smaller
+ * keys with AVX2 compares when compiled with AVX2 enabled.
+ * @tparam K The key type. Must be default-constructible and ordered by operator<.
+ * @tparam V The value type. Must be default-constructible.
+ * @tparam NodeBytes Target size of a node's key array: a multiple of the cache line
+ * size for in-memory use, or a page size for very large maps.
+ */
+template<typename K, typename V, size_t NodeBytes = 256>
+class BTreeMap {
+private:
+    // --- Private Inner Structures ---
+
+    // Keys per node (and entries per leaf). Inner nodes have one more child than keys.
+    static constexpr size_t SLOTS = NodeBytes / sizeof(K) < 4 ? 4 : NodeBytes / sizeof(K);
+    // Every node but the root keeps at least this many keys.
+    static constexpr size_t MIN_KEYS = SLOTS / 2;
+
+    static_assert(SLOTS <= UINT16_MAX, "BTreeMap node size is too large.");
+
+    // Largest key range, in bytes, that the SIMD in-node search scans linearly.
+    static constexpr size_t SIMD_WINDOW_BYTES = 256;
+
+    struct Node {
+        bool leaf;
+        uint16_t count = 0; // Keys in use
+        explicit Node(bool is_leaf) : leaf(is_leaf) {}
+    };
+
+    struct alignas(64) LeafNode : Node {
+        K keys[SLOTS];
+        V values[SLOTS];
+        LeafNode* next = nullptr; // Leaf holding the next larger keys
+        LeafNode() : Node(true) {}
+    };
+
+    // children[i] holds the keys k with keys[i - 1] <= k < keys[i].
+    struct alignas(64) InnerNode : Node {
+        K keys[SLOTS];
+        Node* children[SLOTS + 1];
+        InnerNode() : Node(false) {}
+    };
+
+    // --- Member Variables ---
+
+    Node* root;       // Always valid; an empty map has an empty leaf as root
+    LeafNode* head;   // Leftmost leaf, where iteration starts
+    size_t current_size;
+
+    static LeafNode* as_leaf(Node* node) { return static_cast<LeafNode*>(node); }
+    static InnerNode* as_inner(Node* node) { return static_cast<InnerNode*>(node); }
+
+    static bool equal(const K& a, const K& b) { return !(a < b) && !(b < a); }
+
+    /**
+     * @brief Index of the first of `count` sorted keys that is not less than `key`.
+     */
+    static size_t lower_bound_in(const K* keys, size_t count, const K& key) {
+#if defined(__AVX2__)
+        if constexpr (std::is_integral<K>::value && (sizeof(K) == 8 || sizeof(K) == 4)) {
+            return simd_lower_bound(keys, count, key);
+        }
+#endif
+        return static_cast<size_t>(std::lower_bound(keys, keys + count, key) - keys);
+    }
+
+#if defined(__AVX2__)
+    /**
+     * @brief Counts the keys less than `key` with 256-bit compares. Because the keys
+     * are sorted, that count is also the lower bound. Unsigned keys are compared as
+     * signed after flipping their top bit. Nodes larger than SIMD_WINDOW_BYTES are
+     * first narrowed down by binary search, so page-sized nodes are not scanned whole.
+     */
+    static size_t simd_lower_bound(const K* keys, size_t count, const K& key) {
+        constexpr size_t LANES = 32 / sizeof(K);
+        constexpr size_t WINDOW = SIMD_WINDOW_BYTES / sizeof(K);
+        size_t base = 0;
+        while (count > WINDOW) {
+            size_t half = count / 2;
+            if (keys[base + half] < key) {
+                base += half + 1;
+                count -= half + 1;
+            } else {
+                count = half;
+            }
+        }
+        keys += base;
+
+        size_t less = base;
+        size_t i = 0;
+        if constexpr (sizeof(K) == 8) {
+            const __m256i flip = _mm256_set1_epi64x(std::is_signed<K>::value ? 0 : INT64_MIN);
+            const __m256i needle = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(key)), flip);
+            for (; i + LANES <= count; i += LANES) {
+                __m256i block = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), flip);
+                int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(needle, block)));
+                less += static_cast<size_t>(__builtin_popcount(mask));
+            }
+        } else {
+            const __m256i flip = _mm256_set1_epi32(std::is_signed<K>::value ? 0 : INT32_MIN);
+            const __m256i needle = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int>(key)), flip);
+            for (; i + LANES <= count; i += LANES) {
+                __m256i block = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), flip);
+                int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, block)));
+                less += static_cast<size_t>(__builtin_popcount(mask));
+            }
+        }
+        for (; i < count; ++i) {
+            less += keys[i] < key;
+        }
+        return less;
+    }
+#endif
+
+    /**
+     * @brief The child of an inner node whose subtree may hold `key`.
+     */
+    static size_t child_index(const InnerNode* node, const K& key) {
+        size_t index = lower_bound_in(node->keys, node->count, key);
+        if (index < node->count && equal(node->keys[index], key)) {
+            index++; // Separators are the smallest key of their right subtree
+        }
+        return index;
+    }
+
+    /**
+     * @brief Descends from the root to the leaf whose key range covers `key`.
+     */
+    LeafNode* find_leaf(const K& key) const {
+        Node* node = root;
+        while (!node->leaf) {
+            node = as_inner(node)->children[child_index(as_inner(node), key)];
+        }
+        return as_leaf(node);
+    }
+
+    void free_subtree(Node* node) {
+        if (node->leaf) {
+            delete as_leaf(node);
+            return;
+        }
+        InnerNode* inner = as_inner(node);
+        for (size_t i = 0; i <= inner->count; ++i) {
+            free_subtree(inner->children[i]);
+        }
+        delete inner;
+    }
+
+    /**
+     * @brief Inserts or updates `key` in the subtree of `node`. When the node had to
+     * split, returns true and sets the separator and the new right sibling, which
+     * the caller must add to the parent.
+     */
+    bool insert_into(Node* node, const K& key, const V& value, K& split_key, Node*& split_node) {
+        if (node->leaf) {
+            LeafNode* leaf = as_leaf(node);
+            size_t index = lower_bound_in(leaf->keys, leaf->count, key);
+            if (index < leaf->count && equal(leaf->keys[index], key)) {
+                leaf->values[index] = value;
+                return false;
+            }
+            current_size++;
+
+            if (leaf->count < SLOTS) {
+                insert_into_leaf(leaf, index, key, value);
+                return false;
+            }
+
+            // Full leaf: move the upper half into a new right sibling, then insert.
+            LeafNode* right = new LeafNode();
+            size_t keep = (SLOTS + 1) / 2;
+            std::move(leaf->keys + keep, leaf->keys + SLOTS, right->keys);
+            std::move(leaf->values + keep, leaf->values + SLOTS, right->values);
+            right->count = static_cast<uint16_t>(SLOTS - keep);
+            leaf->count = static_cast<uint16_t>(keep);
+            right->next = leaf->next;
+            leaf->next = right;
+
+            if (index <= keep) {
+                insert_into_leaf(leaf, index, key, value);
+            } else {
+                insert_into_leaf(right, index - keep, key, value);
+            }
+            split_key = right->keys[0];
+            split_node = right;
+            return true;
+        }
+
+        InnerNode* inner = as_inner(node);
+        size_t index = child_index(inner, key);
+        K child_key;
+        Node* child_node = nullptr;
+        if (!insert_into(inner->children[index], key, value, child_key, child_node)) {
+            return false;
+        }
+
+        if (inner->count < SLOTS) {
+            insert_into_inner(inner, index, std::move(child_key), child_node);
+            return false;
+        }
+
+        // Full inner node: lay out all SLOTS + 1 keys, keep the lower half,
+        // push the middle key up and move the upper half into a new right sibling.
+        K keys[SLOTS + 1];
+        Node* children[SLOTS + 2];
+        std::move(inner->keys, inner->keys + index, keys);
+        keys[index] = std::move(child_key);
+        std::move(inner->keys + index, inner->keys + SLOTS, keys + index + 1);
+        std::copy(inner->children, inner->children + index + 1, children);
+        children[index + 1] = child_node;
+        std::copy(inner->children + index + 1, inner->children + SLOTS + 1, children + index + 2);
+
+        InnerNode* right = new InnerNode();
+        size_t mid = (SLOTS + 1) / 2;
+        std::move(keys, keys + mid, inner->keys);
+        std::copy(children, children + mid + 1, inner->children);
+        inner->count = static_cast<uint16_t>(mid);
+        std::move(keys + mid + 1, keys + SLOTS + 1, right->keys);
+        std::copy(children + mid + 1, children + SLOTS + 2, right->children);
+        right->count = static_cast<uint16_t>(SLOTS - mid);
+
+        split_key = std::move(keys[mid]);
+        split_node = right;
+        return true;
+    }
+
+    static void insert_into_leaf(LeafNode* leaf, size_t index, const K& key, const V& value) {
+        std::move_backward(leaf->keys + index, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+        std::move_backward(leaf->values + index, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+        leaf->keys[index] = key;
+        leaf->values[index] = value;
+        leaf->count++;
+    }
+
+    /**
+     * @brief Adds a separator and the child to its right after children[index].
+     */
+    static void insert_into_inner(InnerNode* inner, size_t index, K&& key, Node* child) {
+        std::move_backward(inner->keys + index, inner->keys + inner->count, inner->keys + inner->count + 1);
+        std::copy_backward(inner->children + index + 1, inner->children + inner->count + 1,
+                           inner->children + inner->count + 2);
+        inner->keys[index] = std::move(key);
+        inner->children[index + 1] = child;
+        inner->count++;
+    }
+
+    /**
+     * @brief Removes `key` from the subtree of `node`, refilling any child that drops
+     * below MIN_KEYS on the way back up.
+     * @return True if the key was found.
+     */
+    bool remove_from(Node* node, const K& key) {
+        if (node->leaf) {
+            LeafNode* leaf = as_leaf(node);
+            size_t index = lower_bound_in(leaf->keys, leaf->count, key);
+            if (index == leaf->count || !equal(leaf->keys[index], key)) {
+                return false;
+            }
+            std::move(leaf->keys + index + 1, leaf->keys + leaf->count, leaf->keys + index);
+            std::move(leaf->values + index + 1, leaf->values + leaf->count, leaf->values + index);
+            leaf->count--;
+            return true;
+        }
+
+        // Separators equal to a removed key are left in place: they still split
+        // the key space correctly.
+        InnerNode* inner = as_inner(node);
+        size_t index = child_index(inner, key);
+        if (!remove_from(inner->children[index], key)) {
+            return false;
+        }
+        if (inner->children[index]->count < MIN_KEYS) {
+            rebalance(inner, index);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Refills children[index] of `parent`, which has one key too few, by
+     * borrowing from a sibling that can spare one or else merging with a sibling.
+     */
+    void rebalance(InnerNode* parent, size_t index) {
+        Node* left = index > 0 ? parent->children[index - 1] : nullptr;
+        Node* right = index < parent->count ? parent->children[index + 1] : nullptr;
+
+        if (left != nullptr && left->count > MIN_KEYS) {
+            borrow_from_left(parent, index);
+        } else if (right != nullptr && right->count > MIN_KEYS) {
+            borrow_from_right(parent, index);
+        } else if (left != nullptr) {
+            merge(parent, index - 1);
+        } else {
+            merge(parent, index);
+        }
+    }
+
+    static void borrow_from_left(InnerNode* parent, size_t index) {
+        Node* child = parent->children[index];
+        Node* left = parent->children[index - 1];
+        if (child->leaf) {
+            LeafNode* to = as_leaf(child);
+            LeafNode* from = as_leaf(left);
+            insert_into_leaf(to, 0, from->keys[from->count - 1], from->values[from->count - 1]);
+            from->count--;
+            parent->keys[index - 1] = to->keys[0];
+            return;
+        }
+        InnerNode* to = as_inner(child);
+        InnerNode* from = as_inner(left);
+        std::move_backward(to->keys, to->keys + to->count, to->keys + to->count + 1);
+        std::copy_backward(to->children, to->children + to->count + 1, to->children + to->count + 2);
+        to->keys[0] = std::move(parent->keys[index - 1]);
+        to->children[0] = from->children[from->count];
+        to->count++;
+        parent->keys[index - 1] = std::move(from->keys[from->count - 1]);
+        from->count--;
+    }
+
+    static void borrow_from_right(InnerNode* parent, size_t index) {
+        Node* child = parent->children[index];
+        Node* right = parent->children[index + 1];
+        if (child->leaf) {
+            LeafNode* to = as_leaf(child);
+            LeafNode* from = as_leaf(right);
+            to->keys[to->count] = std::move(from->keys[0]);
+            to->values[to->count] = std::move(from->values[0]);
+            to->count++;
+            std::move(from->keys + 1, from->keys + from->count, from->keys);
+            std::move(from->values + 1, from->values + from->count, from->values);
+            from->count--;
+            parent->keys[index] = from->keys[0];
+            return;
+        }
+        InnerNode* to = as_inner(child);
+        InnerNode* from = as_inner(right);
+        to->keys[to->count] = std::move(parent->keys[index]);
+        to->children[to->count + 1] = from->children[0];
+        to->count++;
+        parent->keys[index] = std::move(from->keys[0]);
+        std::move(from->keys + 1, from->keys + from->count, from->keys);
+        std::copy(from->children + 1, from->children + from->count + 1, from->children);
+        from->count--;
+    }
+
+    /**
+     * @brief Appends children[index + 1] of `parent` to children[index] and frees it.
+     */
+    static void merge(InnerNode* parent, size_t index) {
+        Node* left = parent->children[index];
+        Node* right = parent->children[index + 1];
+        if (left->leaf) {
+            LeafNode* to = as_leaf(left);
+            LeafNode* from = as_leaf(right);
+            std::move(from->keys, from->keys + from->count, to->keys + to->count);
+            std::move(from->values, from->values + from->count, to->values + to->count);
+            to->count = static_cast<uint16_t>(to->count + from->count);
+            to->next = from->next;
+            delete from;
+        } else {
+            InnerNode* to = as_inner(left);
+            InnerNode* from = as_inner(right);
+            to->keys[to->count] = std::move(parent->keys[index]);
+            std::move(from->keys, from->keys + from->count, to->keys + to->count + 1);
+            std::copy(from->children, from->children + from->count + 1, to->children + to->count + 1);
+            to->count = static_cast<uint16_t>(to->count + from->count + 1);
+            delete from;
+        }
+        std::move(parent->keys + index + 1, parent->keys + parent->count, parent->keys + index);
+        std::copy(parent->children + index + 2, parent->children + parent->count + 1, parent->children + index + 1);
+        parent->count--;
+    }
+
+public:
+    // --- Iterators ---
+
+    /**
+     * @brief Forward iterator over the entries in ascending key order.
+     * Dereferences to a (key, value) pair of references.
+     */
+    template<bool Const>
+    class Iterator {
+    private:
+        friend class BTreeMap;
+        using ValueRef = typename std::conditional<Const, const V&, V&>::type;
+
+        LeafNode* leaf = nullptr; // nullptr for end()
+        size_t index = 0;
+
+        Iterator(LeafNode* at_leaf, size_t at_index) : leaf(at_leaf), index(at_index) {
+            skip_exhausted_leaf();
+        }
+
+        void skip_exhausted_leaf() {
+            if (leaf != nullptr && index == leaf->count) {
+                leaf = leaf->next;
+                index = 0;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const K&, ValueRef>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        Iterator() = default;
+
+        // Allows an iterator to convert to a const_iterator.
+        template<bool WasConst, bool C = Const, typename = typename std::enable_if<C && !WasConst>::type>
+        Iterator(const Iterator<WasConst>& other) : leaf(other.leaf), index(other.index) {}
+
+        const K& key() const { return leaf->keys[index]; }
+        ValueRef value() const { return leaf->values[index]; }
+        reference operator*() const { return {leaf->keys[index], leaf->values[index]}; }
+
+        Iterator& operator++() {
+            index++;
+            skip_exhausted_leaf();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const { return leaf == other.leaf && index == other.index; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+        template<bool> friend class Iterator;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /**
+     * @brief A pair of iterators usable in a range-based for loop.
+     */
+    template<typename It>
+    struct IteratorRange {
+        It first;
+        It last;
+        It begin() const { return first; }
+        It end() const { return last; }
+    };
+
+    // --- Constructors and Destructor ---
+
+    BTreeMap() : root(new LeafNode()), head(as_leaf(root)), current_size(0) {}
+
+    ~BTreeMap() {
+        free_subtree(root);
+    }
+
+    // Disallow copying and moving for simplicity, like the hash tables.
+    BTreeMap(const BTreeMap&) = delete;
+    BTreeMap& operator=(const BTreeMap&) = delete;
+
+    // --- Core Functionality ---
+
+    /**
+     * @brief Inserts a key-value pair or updates if key exists.
+     */
+    void insert(const K& key, const V& value) {
+        K split_key;
+        Node* split_node = nullptr;
+        if (insert_into(root, key, value, split_key, split_node)) {
+            // The root split: the tree grows by one level.
+            InnerNode* new_root = new InnerNode();
+            new_root->keys[0] = std::move(split_key);
+            new_root->children[0] = root;
+            new_root->children[1] = split_node;
+            new_root->count = 1;
+            root = new_root;
+        }
+    }
+
+    /**
+     * @brief Searches for a key.
+     * @return An std::optional containing the value if found, otherwise std::nullopt.
+     */
+    std::optional<V> search(const K& key) const {
+        if (const V* value = find(key)) {
+            return *value;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Looks up a key without copying its value.
+     * @return A pointer to the value, or nullptr if the key is absent. Valid until
+     * the next insert or remove.
+     */
+    V* find(const K& key) {
+        LeafNode* leaf = find_leaf(key);
+        size_t index = lower_bound_in(leaf->keys, leaf->count, key);
+        return (index < leaf->count && equal(leaf->keys[index], key)) ? &leaf->values[index] : nullptr;
+    }
+
+    const V* find(const K& key) const {
+        return const_cast<BTreeMap*>(this)->find(key);
+    }
+
+    bool contains(const K& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief Removes a key-value pair.
+     * @return True if the key was found and removed, false otherwise.
+     */
+    bool remove(const K& key) {
+        if (!remove_from(root, key)) {
+            return false;
+        }
+        current_size--;
+        if (!root->leaf && root->count == 0) {
+            // The root's last two children merged: the tree shrinks by one level.
+            InnerNode* old_root = as_inner(root);
+            root = old_root->children[0];
+            delete old_root;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Replaces the contents with `entries`, which must be sorted by strictly
+     * ascending key. Builds the tree bottom-up in O(n) with every node filled evenly
+     * and as full as possible, so it is much faster than n inserts, and the result
+     * is as shallow and compact as a B+tree can be.
+     * @param entries A random-access range of (key, value) pairs.
+     */
+    template<typename Range>
+    void bulk_load(const Range& entries) {
+        size_t count = entries.size();
+        for (size_t i = 1; i < count; ++i) {
+            if (!(entries[i - 1].first < entries[i].first)) {
+                throw std::runtime_error("BTreeMap::bulk_load requires strictly ascending keys.");
+            }
+        }
+
+        clear();
+        if (count == 0) {
+            return;
+        }
+        delete as_leaf(root);
+
+        // Level 0: the leaves, with entries split as evenly as possible.
+        size_t leaf_count = (count + SLOTS - 1) / SLOTS;
+        std::vector<Node*> level(leaf_count);
+        std::vector<K> lowest(leaf_count); // Smallest key under each node of the level
+        LeafNode* previous = nullptr;
+        for (size_t l = 0; l < leaf_count; ++l) {
+            LeafNode* leaf = new LeafNode();
+            size_t first = count * l / leaf_count;
+            size_t last = count * (l + 1) / leaf_count;
+            for (size_t i = first; i < last; ++i) {
+                leaf->keys[i - first] = entries[i].first;
+                leaf->values[i - first] = entries[i].second;
+            }
+            leaf->count = static_cast<uint16_t>(last - first);
+            if (previous != nullptr) {
+                previous->next = leaf;
+            }
+            previous = leaf;
+            level[l] = leaf;
+            lowest[l] = leaf->keys[0];
+        }
+        head = as_leaf(level[0]);
+
+        // Upper levels: group up to SLOTS + 1 nodes under each parent until one remains.
+        while (level.size() > 1) {
+            size_t parent_count = (level.size() + SLOTS) / (SLOTS + 1);
+            std::vector<Node*> parents(parent_count);
+            std::vector<K> parent_lowest(parent_count);
+            for (size_t p = 0; p < parent_count; ++p) {
+                InnerNode* inner = new InnerNode();
+                size_t first = level.size() * p / parent_count;
+                size_t last = level.size() * (p + 1) / parent_count;
+                for (size_t i = first; i < last; ++i) {
+                    inner->children[i - first] = level[i];
+                    if (i > first) {
+                        inner->keys[i - first - 1] = std::move(lowest[i]);
+                    }
+                }
+                inner->count = static_cast<uint16_t>(last - first - 1);
+                parents[p] = inner;
+                parent_lowest[p] = std::move(lowest[first]);
+            }
+            level = std::move(parents);
+            lowest = std::move(parent_lowest);
+        }
+        root = level[0];
+        current_size = count;
+    }
+
+    /**
+     * @brief Removes every entry.
+     */
+    void clear() {
+        free_subtree(root);
+        root = new LeafNode();
+        head = as_leaf(root);
+        current_size = 0;
+    }
+
+    // --- Ordered Access ---
+
+    iterator begin() { return iterator(head, 0); }
+    iterator end() { return iterator(); }
+    const_iterator begin() const { return const_iterator(head, 0); }
+    const_iterator end() const { return const_iterator(); }
+
+    /**
+     * @brief The first entry whose key is not less than `key`, or end().
+     */
+    iterator lower_bound(const K& key) {
+        LeafNode* leaf = find_leaf(key);
+        return iterator(leaf, lower_bound_in(leaf->keys, leaf->count, key));
+    }
+
+    const_iterator lower_bound(const K& key) const {
+        return const_cast<BTreeMap*>(this)->lower_bound(key);
+    }
+
+    /**
+     * @brief The first entry whose key is greater than `key`, or end().
+     */
+    iterator upper_bound(const K& key) {
+        iterator it = lower_bound(key);
+        if (it != end() && equal(it.key(), key)) {
+            ++it;
+        }
+        return it;
+    }
+
+    const_iterator upper_bound(const K& key) const {
+        return const_cast<BTreeMap*>(this)->upper_bound(key);
+    }
+
+    /**
+     * @brief The entries with keys in [low, high), for use in a range-based for loop.
+     */
+    IteratorRange<iterator> range(const K& low, const K& high) {
+        if (!(low < high)) {
+            return {end(), end()};
+        }
+        return {lower_bound(low), lower_bound(high)};
+    }
+
+    IteratorRange<const_iterator> range(const K& low, const K& high) const {
+        auto result = const_cast<BTreeMap*>(this)->range(low, high);
+        return {result.first, result.last};
+    }
+
+    size_t size() const { return current_size; }
+    bool empty() const { return current_size == 0; }
+
+    /**
+     * @brief Number of levels, counting the leaves.
+     */
+    size_t height() const {
+        size_t levels = 1;
+        for (Node* node = root; !node->leaf; node = as_inner(node)->children[0]) {
+            levels++;
+        }
+        return levels;
+    }
+
+    /**
+     * @brief Prints the keys of every node, one tree level per line.
+     */
+    void print() const {
+        std::cout << "--- B+Tree Contents ---" << std::endl;
+        std::cout << "Size: " << current_size << ", Height: " << height() << std::endl;
+        std::vector<Node*> level{root};
+        while (!level.empty()) {
+            std::vector<Node*> below;
+            for (Node* node : level) {
+                std::cout << "[";
+                if (node->leaf) {
+                    LeafNode* leaf = as_leaf(node);
+                    for (size_t i = 0; i < leaf->count; ++i) {
+                        std::cout << (i ? " " : "") << leaf->keys[i] << ":" << leaf->values[i];
+                    }
+                } else {
+                    InnerNode* inner = as_inner(node);
+                    for (size_t i = 0; i < inner->count; ++i) {
+                        std::cout << (i ? " " : "") << inner->keys[i];
+                    }
+                    below.insert(below.end(), inner->children, inner->children + inner->count + 1);
+                }
+                std::cout << "] ";
+            }
+            std::cout << std::endl;
+            level = std::move(below);
+        }
+        std::cout << "-----------------------" << std::endl;
+    }
+};
+
+} // namespace CustomDataStructures
+
+#endif // CUSTOM_BTREE_MAP_H
@@ -0,0 +1,76 @@
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BTreeMap.h"
+
+int main() {
+    using CustomDataStructures::BTreeMap;
+
+    // A 16-byte node size gives the minimum of four keys per node: small enough to watch splits.
+    BTreeMap<std::string, int, 16> student_scores;
+
+    student_scores.insert("Alice", 88);
+    student_scores.insert("Bob", 92);
+    student_scores.insert("Charlie", 75);
+    student_scores.insert("David", 100);
+    std::cout << "After four inserts (one full leaf):" << std::endl;
+    student_scores.print();
+
+    student_scores.insert("Eve", 68);
+    student_scores.insert("Frank", 81);
+    student_scores.insert("Anna", 90);
+    student_scores.insert("Bella", 77);
+    std::cout << "\nAfter four more (the leaf split and the tree grew a level):" << std::endl;
+    student_scores.print();
+
+    std::cout << "\n--- Testing Search ---" << std::endl;
+    if (auto score = student_scores.search("Charlie")) {
+        std::cout << "Charlie's score is: " << *score << std::endl;
+    }
+    if (auto score = student_scores.search("Mallory")) {
+        std::cout << "Mallory's score is: " << *score << std::endl;
+    } else {
+        std::cout << "Mallory not found." << std::endl;
+    }
+
+    std::cout << "\n--- Ordered Iteration and Range Queries ---" << std::endl;
+    for (auto [name, score] : student_scores) {
+        std::cout << name << "=" << score << " ";
+    }
+    std::cout << std::endl;
+
+    std::cout << "Names in [B, E): ";
+    for (auto [name, score] : student_scores.range("B", "E")) {
+        std::cout << name << " ";
+    }
+    std::cout << std::endl;
+
+    std::cout << "Names starting with \"A\": ";
+    for (auto it = student_scores.lower_bound("A"); it != student_scores.end() && it.key().compare(0, 1, "A") == 0; ++it) {
+        std::cout << it.key() << " ";
+    }
+    std::cout << std::endl;
+
+    std::cout << "\n--- Testing Update and Remove ---" << std::endl;
+    student_scores.insert("Alice", 95);
+    std::cout << "Alice's new score is: " << *student_scores.search("Alice") << std::endl;
+    student_scores.remove("Bob");
+    student_scores.remove("Bella");
+    student_scores.remove("Charlie");
+    student_scores.remove("Eve");
+    student_scores.remove("Frank");
+    std::cout << "Removed Bob, Bella, Charlie, Eve and Frank (the leaves merged and the tree shrank a level):" << std::endl;
+    student_scores.print();
+
+    std::cout << "\n--- Bulk Loading Sorted Input ---" << std::endl;
+    std::vector<std::pair<int, int>> squares;
+    for (int i = 0; i < 20; ++i) {
+        squares.emplace_back(i, i * i);
+    }
+    BTreeMap<int, int, 16> table;
+    table.bulk_load(squares);
+    table.print();
+
+    return 0;
+}
@@ -0,0 +1,297 @@
+#ifndef INDEXED_DARY_HEAP_H
+#define INDEXED_DARY_HEAP_H
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include "../1_Vector/DynamicVector.h"
+
+namespace CustomDataStructures {
+
+/**
+ * @brief A D-ary heap whose elements can be changed or removed after insertion.
+ *
+ * push() returns a Handle that stays valid until the element leaves the heap.
+ * A handle map records the current heap position of every handle, so
+ * decrease_key(), update() and erase() find their element in O(1) and restore
+ * the heap in O(log_D n). This is the structure Dijkstra's algorithm and timer
+ * schedulers need, and which std::priority_queue cannot offer. Released handles
+ * are recycled, so the map stays as small as the largest heap.
+ *
+ * Each heap slot stores its element next to its handle, so sifting moves both
+ * with one copy and keeps the handle map in step.
+ *
+ * Ordering follows DaryHeap: with the default std::less, top() is the largest
+ * element; use std::greater for a min-heap.
+ * @tparam T The type of elements to be stored.
+ * @tparam D The arity: number of children per node (at least 2).
+ * @tparam Compare A strict weak ordering; the element that compares greatest is on top.
+ */
+template<typename T, int D = 4, typename Compare = std::less<T>>
+class IndexedDaryHeap {
+    static_assert(D >= 2, "A heap needs at least two children per node.");
+
+public:
+    using Handle = int;
+
+private:
+    // --- Private Inner Structures ---
+
+    struct Entry {
+        T value;
+        Handle handle;
+    };
+
+    static constexpr int FREE = -1;
+
+    Vector<Entry> heap;          // Heap order: the children of i are D*i+1 .. D*i+D
+    Vector<int> positions;       // Heap position of each handle, or FREE
+    Vector<Handle> free_handles; // Released handles, reused before new ones
+    Compare compare;
+
+    static int parent(int index) { return (index - 1) / D; }
+    static int first_child(int index) { return D * index + 1; }
+
+    void place(int index, Entry entry) {
+        positions[entry.handle] = index;
+        heap[index] = std::move(entry);
+    }
+
+    void sift_up(int index, Entry entry) {
+        while (index > 0) {
+            int up = parent(index);
+            if (!compare(heap[up].value, entry.value)) {
+                break;
+            }
+            place(index, std::move(heap[up]));
+            index = up;
+        }
+        place(index, std::move(entry));
+    }
+
+    // Returns the highest ranked of the siblings starting at `child` (see DaryHeap).
+    int best_child(int child, int count) const {
+        int best = child;
+        if (child + D <= count) {
+            for (int c = child + 1; c < child + D; ++c) {
+                if (compare(heap[best].value, heap[c].value)) {
+                    best = c;
+                }
+            }
+        } else {
+            for (int c = child + 1; c < count; ++c) {
+                if (compare(heap[best].value, heap[c].value)) {
+                    best = c;
+                }
+            }
+        }
+        return best;
+    }
+
+    void sift_down(int index, Entry entry) {
+        int count = heap.size();
+        while (true) {
+            int child = first_child(index);
+            if (child >= count) {
+                break;
+            }
+            int best = best_child(child, count);
+            if (!compare(entry.value, heap[best].value)) {
+                break;
+            }
+            place(index, std::move(heap[best]));
+            index = best;
+        }
+        place(index, std::move(entry));
+    }
+
+    /**
+     * @brief Fills the hole at `index`: the hole sinks to a leaf by promoting the
+     * best child at each level, then `entry` climbs up from there. The climb may
+     * pass `index` itself, so this also handles an entry that belongs above the hole.
+     */
+    void refill(int index, Entry entry) {
+        int count = heap.size();
+        while (true) {
+            int child = first_child(index);
+            if (child >= count) {
+                break;
+            }
+            int best = best_child(child, count);
+            place(index, std::move(heap[best]));
+            index = best;
+        }
+        sift_up(index, std::move(entry));
+    }
+
+    int position_of(Handle handle) const {
+        if (handle < 0 || handle >= positions.size() || positions[handle] == FREE) {
+            throw std::out_of_range("Invalid heap handle");
+        }
+        return positions[handle];
+    }
+
+    /**
+     * @brief Takes the entry at `index` out of the heap, fills the hole with the
+     * last entry and releases the handle.
+     */
+    void remove_at(int index) {
+        Handle handle = heap[index].handle;
+        Entry last = std::move(heap[heap.size() - 1]);
+        heap.pop_back();
+        positions[handle] = FREE;
+        free_handles.push_back(handle);
+        if (index < heap.size()) {
+            refill(index, std::move(last));
+        }
+    }
+
+public:
+    // --- Constructors ---
+
+    explicit IndexedDaryHeap(const Compare& comp = Compare()) : compare(comp) {}
+
+    // --- Core Functionality ---
+
+    /**
+     * @brief Inserts an element. O(log_D n).
+     * @return The handle by which the element can later be changed or erased.
+     */
+    Handle push(const T& value) {
+        Handle handle;
+        if (!free_handles.empty()) {
+            handle = free_handles[free_handles.size() - 1];
+            free_handles.pop_back();
+        } else {
+            handle = positions.size();
+            positions.push_back(FREE);
+        }
+        heap.push_back(Entry{value, handle});
+        sift_up(heap.size() - 1, Entry{value, handle});
+        return handle;
+    }
+
+    /**
+     * @brief Returns the highest ranked element.
+     * @throws std::out_of_range if the heap is empty.
+     */
+    const T& top() const {
+        if (heap.empty()) {
+            throw std::out_of_range("Heap is empty");
+        }
+        return heap[0].value;
+    }
+
+    /**
+     * @brief Returns the handle of the highest ranked element.
+     * @throws std::out_of_range if the heap is empty.
+     */
+    Handle top_handle() const {
+        if (heap.empty()) {
+            throw std::out_of_range("Heap is empty");
+        }
+        return heap[0].handle;
+    }
+
+    /**
+     * @brief Removes the highest ranked element and releases its handle. O(D log_D n).
+     * @throws std::out_of_range if the heap is empty.
+     */
+    void pop() {
+        if (heap.empty()) {
+            throw std::out_of_range("Heap is empty");
+        }
+        remove_at(0);
+    }
+
+    /**
+     * @brief Gives an element a value that ranks at least as high as its current
+     * one (a smaller key in a min-heap ordered by std::greater) and moves it up.
+     * O(log_D n).
+     * @throws std::out_of_range if the handle is not in the heap.
+     * @throws std::invalid_argument if the new value ranks lower.
+     */
+    void decrease_key(Handle handle, const T& value) {
+        int index = position_of(handle);
+        if (compare(value, heap[index].value)) {
+            throw std::invalid_argument("decrease_key would lower the element's priority");
+        }
+        sift_up(index, Entry{value, handle});
+    }
+
+    /**
+     * @brief Replaces an element's value, moving it up or down as needed. O(D log_D n).
+     * @throws std::out_of_range if the handle is not in the heap.
+     */
+    void update(Handle handle, const T& value) {
+        int index = position_of(handle);
+        if (compare(heap[index].value, value)) {
+            sift_up(index, Entry{value, handle});
+        } else {
+            sift_down(index, Entry{value, handle});
+        }
+    }
+
+    /**
+     * @brief Removes an element wherever it is in the heap and releases its handle.
+     * O(D log_D n).
+     * @throws std::out_of_range if the handle is not in the heap.
+     */
+    void erase(Handle handle) {
+        remove_at(position_of(handle));
+    }
+
+    /**
+     * @brief Replaces the contents with `items` in O(n) by Floyd's bottom-up
+     * construction. The element items[i] receives handle i.
+     */
+    void heapify(const Vector<T>& items) {
+        heap = Vector<Entry>();
+        positions = Vector<int>();
+        free_handles = Vector<Handle>();
+        heap.reserve(items.size());
+        positions.reserve(items.size());
+        for (int i = 0; i < items.size(); ++i) {
+            heap.push_back(Entry{items[i], i});
+            positions.push_back(i);
+        }
+        for (int index = parent(heap.size() - 1); heap.size() > 1 && index >= 0; --index) {
+            sift_down(index, std::move(heap[index]));
+        }
+    }
+
+    /**
+     * @brief Pre-allocates room for `count` elements and handles.
+     */
+    void reserve(int count) {
+        heap.reserve(count);
+        positions.reserve(count);
+        free_handles.reserve(count);
+    }
+
+    // --- Handle Queries ---
+
+    /**
+     * @brief Checks whether a handle currently refers to an element in the heap.
+     */
+    bool contains(Handle handle) const {
+        return handle >= 0 && handle < positions.size() && positions[handle] != FREE;
+    }
+
+    /**
+     * @brief Returns the current value of the element behind a handle.
+     * @throws std::out_of_range if the handle is not in the heap.
+     */
+    const T& get(Handle handle) const {
+        return heap[position_of(handle)].value;
+    }
+
+    // --- Capacity and Size ---
+
+    int size() const { return heap.size(); }
+    bool empty() const { return heap.empty(); }
+};
+
+} // namespace CustomDataStructures
+
+#endif // INDEXED_DARY_HEAP_H
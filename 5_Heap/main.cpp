@@ -0,0 +1,73 @@
+#include <functional>
+#include <iostream>
+#include <string>
+#include "DaryHeap.h"
+#include "IndexedDaryHeap.h"
+
+int main() {
+    using CustomDataStructures::DaryHeap;
+    using CustomDataStructures::IndexedDaryHeap;
+
+    std::cout << "--- DaryHeap<int, 4> (max-heap) ---" << std::endl;
+    DaryHeap<int, 4> heap;
+    for (int value : {42, 7, 19, 88, 3, 56, 23}) {
+        heap.push(value);
+    }
+    std::cout << "Size: " << heap.size() << ", top: " << heap.top() << std::endl;
+    std::cout << "Popping in order: ";
+    while (!heap.empty()) {
+        std::cout << heap.top() << " ";
+        heap.pop();
+    }
+    std::cout << std::endl;
+
+    std::cout << "\n--- heapify() into a DaryHeap<int, 8, std::greater<int>> (min-heap) ---" << std::endl;
+    Vector<int> items;
+    for (int i = 20; i > 0; --i) {
+        items.push_back((i * 37) % 101);
+    }
+    DaryHeap<int, 8, std::greater<int>> min_heap;
+    min_heap.heapify(items);
+    std::cout << "Smallest five: ";
+    for (int i = 0; i < 5; ++i) {
+        std::cout << min_heap.top() << " ";
+        min_heap.pop();
+    }
+    std::cout << std::endl;
+
+    std::cout << "\n--- IndexedDaryHeap: a task scheduler ordered by deadline ---" << std::endl;
+    IndexedDaryHeap<int, 4, std::greater<int>> deadlines;
+    std::string names[] = {"backup", "email", "report", "deploy"};
+    IndexedDaryHeap<int, 4, std::greater<int>>::Handle handles[4];
+    int initial[] = {50, 30, 40, 60};
+    for (int i = 0; i < 4; ++i) {
+        handles[i] = deadlines.push(initial[i]);
+    }
+    std::cout << "Next due: handle " << deadlines.top_handle() << " at " << deadlines.top() << std::endl;
+
+    std::cout << "deploy becomes urgent: decrease_key to 10" << std::endl;
+    deadlines.decrease_key(handles[3], 10);
+    std::cout << "Next due: handle " << deadlines.top_handle() << " at " << deadlines.top() << std::endl;
+
+    std::cout << "email is cancelled: erase" << std::endl;
+    deadlines.erase(handles[1]);
+
+    std::cout << "report is postponed: update to 70" << std::endl;
+    deadlines.update(handles[2], 70);
+
+    try {
+        deadlines.decrease_key(handles[0], 90);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "decrease_key to a later deadline throws: " << e.what() << std::endl;
+    }
+
+    std::cout << "Running in order:" << std::endl;
+    while (!deadlines.empty()) {
+        int handle = deadlines.top_handle();
+        std::cout << "  " << names[handle] << " at " << deadlines.top() << std::endl;
+        deadlines.pop();
+    }
+    std::cout << "Handle of email still valid? " << (deadlines.contains(handles[1]) ? "yes" : "no") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Small helpers shared by the standalone benchmark programs.
+ *
+ * Every benchmark takes its problem size from the command line so the same
+ * binary can be run both as a quick smoke test and on tables far larger than
+ * the last-level cache.
+ */
+namespace Bench {
+
+/**
+ * @brief Wall-clock stopwatch with millisecond resolution.
+ */
+class Timer {
+private:
+    std::chrono::steady_clock::time_point start;
+
+public:
+    Timer() : start(std::chrono::steady_clock::now()) {}
+
+    void reset() { start = std::chrono::steady_clock::now(); }
+
+    double elapsed_ms() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+/**
+ * @brief SplitMix64: a tiny, fast and reproducible 64-bit generator.
+ */
+inline uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Generates `count` pseudo-random 64-bit keys from a fixed seed.
+ */
+inline std::vector<uint64_t> random_keys(size_t count, uint64_t seed) {
+    std::vector<uint64_t> keys(count);
+    for (auto& key : keys) {
+        key = splitmix64(seed);
+    }
+    return keys;
+}
+
+/**
+ * @brief Keeps the compiler from discarding a computed value.
+ */
+template<typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Reads a size argument, falling back to a default when absent.
+ */
+inline size_t size_arg(int argc, char** argv, int position, size_t fallback) {
+    if (argc > position) {
+        return static_cast<size_t>(std::strtoull(argv[position], nullptr, 10));
+    }
+    return fallback;
+}
+
+/**
+ * @brief Prints one result row: label, time and throughput in million operations/s.
+ */
+inline void report(const std::string& label, size_t operations, double ms) {
+    std::cout << "  " << label << ": " << ms << " ms, "
+              << (static_cast<double>(operations) / (ms * 1000.0)) << " Mops/s" << std::endl;
+}
+
+/**
+ * @brief Prints a latency distribution in nanoseconds: average and tail
+ * (p99, p99.99, max). Sorts `latencies` in place.
+ */
+inline void report_latency(const std::string& label, std::vector<double>& latencies) {
+    if (latencies.empty()) {
+        return;
+    }
+    double total = 0;
+    for (double latency : latencies) total += latency;
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) { return latencies[static_cast<size_t>(p * (latencies.size() - 1))]; };
+
+    std::cout << "  " << label << ": avg " << total / latencies.size() << " ns, p99 " << percentile(0.99)
+              << " ns, p99.99 " << percentile(0.9999) << " ns, max " << latencies.back() << " ns" << std::endl;
+}
+
+} // namespace Bench
+
+#endif // BENCH_COMMON_H
@@ -0,0 +1,117 @@
+#ifndef BENCH_PERF_COUNTERS_H
+#define BENCH_PERF_COUNTERS_H
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Bench {
+
+/**
+ * @brief Hardware counters read around a measured region through Linux
+ * perf_event_open: cycles, instructions, cache misses and branch misses of the
+ * calling thread, in user space only.
+ *
+ * The counters are opened as one group, so they are scheduled together and all
+ * cover exactly the same instructions. Opening fails without a PMU (most VMs and
+ * containers) or when kernel.perf_event_paranoid forbids it; available() then
+ * returns false, the benchmarks still run, and no counters are reported.
+ */
+class PerfCounters {
+public:
+    static constexpr int COUNT = 4;
+    static constexpr const char* NAMES[COUNT] = {"cycles", "instructions", "cache_misses", "branch_misses"};
+
+    struct Reading {
+        bool valid = false;
+        uint64_t values[COUNT] = {};
+    };
+
+private:
+    int fds[COUNT] = {-1, -1, -1, -1};
+
+#if defined(__linux__)
+    static int open_counter(uint64_t config, int group_fd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = group_fd == -1 ? 1 : 0; // The leader starts the whole group
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+#endif
+
+public:
+    PerfCounters() {
+#if defined(__linux__)
+        const uint64_t configs[COUNT] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                         PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        for (int i = 0; i < COUNT; ++i) {
+            fds[i] = open_counter(configs[i], i == 0 ? -1 : fds[0]);
+            if (fds[i] == -1) {
+                close_all();
+                return;
+            }
+        }
+#endif
+    }
+
+    ~PerfCounters() {
+        close_all();
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return fds[0] != -1; }
+
+    void start() {
+#if defined(__linux__)
+        if (available()) {
+            ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    Reading stop() {
+        Reading reading;
+#if defined(__linux__)
+        if (available()) {
+            ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            uint64_t buffer[1 + COUNT]; // Group format: the count, then one value per counter
+            if (read(fds[0], buffer, sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer)) && buffer[0] == COUNT) {
+                reading.valid = true;
+                for (int i = 0; i < COUNT; ++i) reading.values[i] = buffer[1 + i];
+            }
+        }
+#endif
+        return reading;
+    }
+
+private:
+    void close_all() {
+#if defined(__linux__)
+        for (int& fd : fds) {
+            if (fd != -1) {
+                close(fd);
+                fd = -1;
+            }
+        }
+#endif
+    }
+};
+
+} // namespace Bench
+
+#endif // BENCH_PERF_COUNTERS_H
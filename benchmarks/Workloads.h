@@ -0,0 +1,170 @@
+#ifndef BENCH_WORKLOADS_H
+#define BENCH_WORKLOADS_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "BenchCommon.h"
+
+/**
+ * @brief Reproducible key streams for the benchmark suite. Every stream is a pure
+ * function of (distribution, count, seed), so runs on different machines or
+ * commits see identical inputs.
+ */
+namespace Bench {
+
+enum class Distribution {
+    Uniform,     // Pseudo-random 64-bit keys
+    Zipfian,     // Skewed draws (theta 0.99) from a universe of uniform keys
+    Sequential,  // 0, 1, 2, ...
+    Adversarial  // Multiples of 2^32: identical low bits, so identity hashes collide
+};
+
+inline const char* distribution_name(Distribution distribution) {
+    switch (distribution) {
+        case Distribution::Uniform: return "uniform";
+        case Distribution::Zipfian: return "zipfian";
+        case Distribution::Sequential: return "sequential";
+        case Distribution::Adversarial: return "adversarial";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Draws ranks in [0, n) with P(rank k) proportional to 1 / (k + 1)^theta,
+ * using the closed-form method of Gray et al. ("Quickly generating billion-record
+ * synthetic databases"), as YCSB does. Construction is O(n), each draw O(1).
+ */
+class ZipfianGenerator {
+private:
+    uint64_t items;
+    double theta;
+    double alpha;
+    double zeta_n;
+    double eta;
+    uint64_t state;
+
+    static double zeta(uint64_t n, double theta) {
+        double sum = 0;
+        for (uint64_t i = 1; i <= n; ++i) {
+            sum += 1.0 / std::pow(static_cast<double>(i), theta);
+        }
+        return sum;
+    }
+
+public:
+    ZipfianGenerator(uint64_t n, uint64_t seed, double skew = 0.99)
+        : items(n), theta(skew), alpha(1.0 / (1.0 - skew)), zeta_n(zeta(n, skew)), state(seed) {
+        double zeta_2 = zeta(2, theta);
+        eta = (1.0 - std::pow(2.0 / static_cast<double>(n), 1.0 - theta)) / (1.0 - zeta_2 / zeta_n);
+    }
+
+    uint64_t next() {
+        double u = static_cast<double>(splitmix64(state) >> 11) * (1.0 / 9007199254740992.0);
+        double uz = u * zeta_n;
+        if (uz < 1.0) {
+            return 0;
+        }
+        if (uz < 1.0 + std::pow(0.5, theta)) {
+            return items > 1 ? 1 : 0;
+        }
+        uint64_t rank = static_cast<uint64_t>(static_cast<double>(items) * std::pow(eta * u - eta + 1.0, alpha));
+        return rank < items ? rank : items - 1;
+    }
+};
+
+/**
+ * @brief The keys inserted by a workload, in insertion order. Zipfian streams
+ * repeat popular keys, so they hold fewer than `count` distinct keys.
+ */
+inline std::vector<uint64_t> build_keys(Distribution distribution, size_t count, uint64_t seed) {
+    std::vector<uint64_t> keys(count);
+    switch (distribution) {
+        case Distribution::Uniform:
+            keys = random_keys(count, seed);
+            break;
+        case Distribution::Zipfian: {
+            std::vector<uint64_t> universe = random_keys(count, seed);
+            ZipfianGenerator ranks(count, seed + 1);
+            for (auto& key : keys) key = universe[ranks.next()];
+            break;
+        }
+        case Distribution::Sequential:
+            for (size_t i = 0; i < count; ++i) keys[i] = i;
+            break;
+        case Distribution::Adversarial:
+            for (size_t i = 0; i < count; ++i) keys[i] = (i + 1) << 32;
+            break;
+    }
+    return keys;
+}
+
+/**
+ * @brief `count` lookups against the keys of build_keys(distribution, ..., seed):
+ * uniform picks, Zipf-skewed picks, the insertion order, or (adversarial) the
+ * reverse insertion order, which walks the longest chains first. All of them hit,
+ * except Zipfian draws of keys so rare that the build stream never produced them.
+ */
+inline std::vector<uint64_t> query_keys(Distribution distribution, const std::vector<uint64_t>& keys,
+                                        size_t count, uint64_t seed) {
+    std::vector<uint64_t> queries(count);
+    uint64_t state = seed;
+    switch (distribution) {
+        case Distribution::Uniform:
+            for (auto& query : queries) query = keys[splitmix64(state) % keys.size()];
+            break;
+        case Distribution::Zipfian: {
+            std::vector<uint64_t> universe = random_keys(keys.size(), seed);
+            ZipfianGenerator ranks(keys.size(), seed + 2); // Same popularity, fresh draws
+            for (auto& query : queries) query = universe[ranks.next()];
+            break;
+        }
+        case Distribution::Sequential:
+            for (size_t i = 0; i < count; ++i) queries[i] = keys[i % keys.size()];
+            break;
+        case Distribution::Adversarial:
+            for (size_t i = 0; i < count; ++i) queries[i] = keys[keys.size() - 1 - i % keys.size()];
+            break;
+    }
+    return queries;
+}
+
+/**
+ * @brief `count` positions in [0, size) for array reads: uniform, Zipf-skewed
+ * towards the front, in order, or (adversarial) a column-major walk with a
+ * 4 KiB stride, which maps consecutive reads to the same cache set.
+ */
+inline std::vector<uint32_t> index_stream(Distribution distribution, size_t size, size_t element_bytes,
+                                          size_t count, uint64_t seed) {
+    std::vector<uint32_t> indices(count);
+    uint64_t state = seed;
+    switch (distribution) {
+        case Distribution::Uniform:
+            for (auto& index : indices) index = static_cast<uint32_t>(splitmix64(state) % size);
+            break;
+        case Distribution::Zipfian: {
+            ZipfianGenerator ranks(size, seed);
+            for (auto& index : indices) index = static_cast<uint32_t>(ranks.next());
+            break;
+        }
+        case Distribution::Sequential:
+            for (size_t i = 0; i < count; ++i) indices[i] = static_cast<uint32_t>(i % size);
+            break;
+        case Distribution::Adversarial: {
+            size_t stride = 4096 / element_bytes > 0 ? 4096 / element_bytes : 1;
+            size_t rows = size / stride > 0 ? size / stride : 1;
+            for (size_t i = 0; i < count; ++i) {
+                size_t row = i % rows;
+                size_t column = (i / rows) % stride;
+                size_t index = row * stride + column;
+                indices[i] = static_cast<uint32_t>(index < size ? index : index % size);
+            }
+            break;
+        }
+    }
+    return indices;
+}
+
+} // namespace Bench
+
+#endif // BENCH_WORKLOADS_H
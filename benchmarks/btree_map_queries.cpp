@@ -0,0 +1,130 @@
+// Point lookups, range scans, random inserts and construction from sorted input
+// for BTreeMap (256-byte and 4 KiB nodes) against std::map, with 8-byte keys.
+// Each range scan visits the entries of [key, key + span) after one lower_bound.
+// Build with -mavx2 (or -march=native) to enable the SIMD in-node search.
+//
+// Usage: btree_map_queries [entries = 1000000] [queries = 1000000] [span = 1000]
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BenchCommon.h"
+#include "../4_BTree/BTreeMap.h"
+
+using CustomDataStructures::BTreeMap;
+
+struct Workload {
+    std::vector<std::pair<uint64_t, uint64_t>> sorted; // Every entry, ascending
+    std::vector<uint64_t> shuffled;                    // The same keys in random order
+    std::vector<uint64_t> queries;                     // Half hits, half misses
+    uint64_t span;
+};
+
+template<typename Map>
+static void run_queries(const std::string& name, const Map& map, const Workload& work) {
+    uint64_t sum = 0;
+    Bench::Timer timer;
+    for (uint64_t key : work.queries) {
+        auto it = map.find(key);
+        if (it != map.end()) {
+            sum += it->second;
+        }
+    }
+    Bench::report(name + ", point lookups", work.queries.size(), timer.elapsed_ms());
+
+    size_t visited = 0;
+    timer.reset();
+    for (size_t i = 0; i < work.queries.size() / 100; ++i) {
+        uint64_t low = work.queries[i];
+        for (auto it = map.lower_bound(low), end = map.lower_bound(low + work.span); it != end; ++it) {
+            sum += it->second;
+            visited++;
+        }
+    }
+    Bench::report(name + ", range scans (entries visited)", visited, timer.elapsed_ms());
+    Bench::do_not_optimize(sum);
+}
+
+template<size_t NodeBytes>
+static void run_tree(const std::string& name, const Workload& work) {
+    {
+        BTreeMap<uint64_t, uint64_t, NodeBytes> tree;
+        Bench::Timer timer;
+        for (uint64_t key : work.shuffled) {
+            tree.insert(key, key);
+        }
+        Bench::report(name + ", random inserts", work.shuffled.size(), timer.elapsed_ms());
+    }
+
+    BTreeMap<uint64_t, uint64_t, NodeBytes> tree;
+    Bench::Timer timer;
+    tree.bulk_load(work.sorted);
+    Bench::report(name + ", bulk_load", work.sorted.size(), timer.elapsed_ms());
+
+    uint64_t sum = 0;
+    timer.reset();
+    for (uint64_t key : work.queries) {
+        if (const uint64_t* value = tree.find(key)) {
+            sum += *value;
+        }
+    }
+    Bench::report(name + ", point lookups", work.queries.size(), timer.elapsed_ms());
+
+    size_t visited = 0;
+    timer.reset();
+    for (size_t i = 0; i < work.queries.size() / 100; ++i) {
+        uint64_t low = work.queries[i];
+        for (auto [key, value] : tree.range(low, low + work.span)) {
+            sum += value;
+            visited++;
+        }
+    }
+    Bench::report(name + ", range scans (entries visited)", visited, timer.elapsed_ms());
+    Bench::do_not_optimize(sum);
+}
+
+int main(int argc, char** argv) {
+    size_t entries = Bench::size_arg(argc, argv, 1, 1000000);
+    size_t query_count = Bench::size_arg(argc, argv, 2, 1000000);
+
+    // Keys are even, spread over [0, 2^40): misses are the odd neighbours of hits.
+    Workload work;
+    work.span = Bench::size_arg(argc, argv, 3, 1000) * ((uint64_t(1) << 40) / (entries + 1));
+    work.shuffled = Bench::random_keys(entries, 35);
+    for (uint64_t& key : work.shuffled) {
+        key = (key >> 24) & ~uint64_t(1);
+    }
+    std::sort(work.shuffled.begin(), work.shuffled.end());
+    work.shuffled.erase(std::unique(work.shuffled.begin(), work.shuffled.end()), work.shuffled.end());
+    for (uint64_t key : work.shuffled) {
+        work.sorted.emplace_back(key, key);
+    }
+    uint64_t state = 36;
+    for (size_t i = work.shuffled.size(); i > 1; --i) {
+        std::swap(work.shuffled[i - 1], work.shuffled[Bench::splitmix64(state) % i]);
+    }
+    for (size_t i = 0; i < query_count; ++i) {
+        work.queries.push_back(work.shuffled[Bench::splitmix64(state) % work.shuffled.size()] | (i & 1));
+    }
+
+    std::cout << "Ordered maps (" << work.sorted.size() << " entries, " << query_count << " queries)" << std::endl;
+    {
+        std::map<uint64_t, uint64_t> map;
+        Bench::Timer timer;
+        for (uint64_t key : work.shuffled) {
+            map.emplace(key, key);
+        }
+        Bench::report("std::map, random inserts", work.shuffled.size(), timer.elapsed_ms());
+
+        timer.reset();
+        std::map<uint64_t, uint64_t> built(work.sorted.begin(), work.sorted.end());
+        Bench::report("std::map, from sorted range", work.sorted.size(), timer.elapsed_ms());
+        run_queries("std::map", built, work);
+    }
+    run_tree<256>("BTreeMap<256>", work);
+    run_tree<4096>("BTreeMap<4096>", work);
+    return 0;
+}
@@ -0,0 +1,414 @@
+// The regression suite: every container against its std:: counterpart, over
+// sizes 10^3 .. max_entries, four key distributions (see Workloads.h) and three
+// payload types (8-byte integers, 64-byte structs, 32-character strings).
+//
+// Each case is built from scratch `repeats` times and the fastest run is kept.
+// Around the timed region the suite reads cycles, instructions, cache misses and
+// branch misses through perf_event_open when the kernel allows it. Results go to
+// stdout as a table (with the ratio to the std:: container) and to a JSON file for
+// trend tracking. Inputs depend only on the arguments, so runs are comparable
+// across commits.
+//
+// Adversarial cases stop at 4096 entries: the chaining and open-addressing tables
+// use std::hash (the identity for integers) modulo a power of two, so those keys
+// all share one bucket and inserts are quadratic. CuckooHashTable only offers
+// search(), which returns a copy of the value; the other maps are read via find().
+//
+// Usage: container_suite [max_entries = 1000000] [output = container_suite.json]
+//                        [repeats = 3] [filter = ""]
+// `filter` keeps only the cases whose group or container name contains it.
+
+#include <chrono>
+#include <cstdint>
+#include <forward_list>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "BenchCommon.h"
+#include "PerfCounters.h"
+#include "Workloads.h"
+#include "../1_Vector/DynamicVector.h"
+#include "../2_LinkedList/SinglyLinkedList.h"
+#include "../2_LinkedList/DoublyLinkedList.h"
+#include "../3_HashMap/ChainingMethod/HashTable_Chaining.h"
+#include "../3_HashMap/OpenAddressingMethod/HashTableOpenAddressing.h"
+#include "../3_HashMap/CuckooMethod/CuckooHashTable.h"
+#include "../4_BTree/BTreeMap.h"
+#include "../5_Heap/DaryHeap.h"
+
+using namespace CustomDataStructures;
+using Bench::Distribution;
+
+static constexpr uint64_t SEED = 42;
+static constexpr size_t ADVERSARIAL_LIMIT = 4096;
+static constexpr Distribution DISTRIBUTIONS[] = {Distribution::Uniform, Distribution::Zipfian,
+                                                 Distribution::Sequential, Distribution::Adversarial};
+
+// --- Payloads ---
+
+struct Payload64 {
+    uint64_t words[8] = {};
+};
+
+template<typename P> P make_payload(uint64_t seed);
+template<> uint64_t make_payload<uint64_t>(uint64_t seed) { return seed; }
+template<> Payload64 make_payload<Payload64>(uint64_t seed) {
+    Payload64 payload;
+    for (int i = 0; i < 8; ++i) payload.words[i] = seed + i;
+    return payload;
+}
+template<> std::string make_payload<std::string>(uint64_t seed) {
+    std::string text(32, 'a'); // Longer than the small-string buffer, so it allocates
+    for (int i = 0; i < 16; ++i) text[i] = static_cast<char>('a' + (seed >> (4 * i)) % 16);
+    return text;
+}
+
+// Reduces a payload to a number, so that reads cannot be optimized away.
+static uint64_t fold(uint64_t value) { return value; }
+static uint64_t fold(const Payload64& value) { return value.words[0] ^ value.words[7]; }
+static uint64_t fold(const std::string& value) { return value.size() + static_cast<unsigned char>(value[0]); }
+
+template<typename P> const char* payload_name();
+template<> const char* payload_name<uint64_t>() { return "u64"; }
+template<> const char* payload_name<Payload64>() { return "struct64"; }
+template<> const char* payload_name<std::string>() { return "string32"; }
+
+// --- Results ---
+
+struct Result {
+    std::string group;
+    std::string container;
+    bool baseline;          // The std:: counterpart
+    std::string operation;
+    std::string distribution;
+    std::string payload;
+    size_t size;
+    size_t operations;
+    double ns_per_op;
+    Bench::PerfCounters::Reading counters;
+};
+
+/**
+ * @brief Runs cases, keeps their results and writes them out.
+ */
+class Suite {
+private:
+    Bench::PerfCounters counters;
+    std::vector<Result> results;
+    size_t repeats;
+    std::string filter;
+
+public:
+    Suite(size_t repeat_count, std::string name_filter)
+        : repeats(repeat_count > 0 ? repeat_count : 1), filter(std::move(name_filter)) {}
+
+    bool counters_available() const { return counters.available(); }
+
+    bool selected(const std::string& group, const std::string& container) const {
+        return filter.empty() || group.find(filter) != std::string::npos || container.find(filter) != std::string::npos;
+    }
+
+    /**
+     * @brief Measures one case. `setup()` returns fresh state (untimed); `body(state)`
+     * performs `operations` operations on it (timed) and returns a checksum.
+     */
+    template<typename Setup, typename Body>
+    void run(Result result, Setup setup, Body body) {
+        if (!selected(result.group, result.container)) {
+            return;
+        }
+        double best = 0;
+        // The containers print an [INFO] line on every resize; keep those out.
+        std::streambuf* saved = std::cout.rdbuf(nullptr);
+        for (size_t r = 0; r < repeats; ++r) {
+            auto state = setup();
+            counters.start();
+            auto start = std::chrono::steady_clock::now();
+            uint64_t checksum = body(*state);
+            double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            Bench::PerfCounters::Reading reading = counters.stop();
+            Bench::do_not_optimize(checksum);
+            state.reset(); // Destroy outside the timed region
+            if (r == 0 || ns < best) {
+                best = ns;
+                result.counters = reading;
+            }
+        }
+        std::cout.rdbuf(saved);
+        result.ns_per_op = best / static_cast<double>(result.operations);
+        results.push_back(result);
+    }
+
+    /**
+     * @brief Prints one line per case, with the time relative to the std:: counterpart
+     * of the same operation, distribution, payload and size.
+     */
+    void print_table() const {
+        for (const Result& result : results) {
+            std::cout << "  " << result.group << " / " << result.operation << " / " << result.distribution << " / "
+                      << result.payload << " / " << result.size << ": " << result.container << " "
+                      << result.ns_per_op << " ns/op";
+            if (!result.baseline) {
+                for (const Result& other : results) {
+                    if (other.baseline && other.group == result.group && other.operation == result.operation
+                        && other.distribution == result.distribution && other.payload == result.payload
+                        && other.size == result.size) {
+                        std::cout << " (" << result.ns_per_op / other.ns_per_op << "x " << other.container << ")";
+                    }
+                }
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    void write_json(const std::string& path, size_t max_entries) const {
+        std::ofstream out(path);
+        if (!out) {
+            throw std::runtime_error("Cannot write " + path);
+        }
+        out << "{\n  \"suite\": \"container_suite\",\n  \"format\": 1,\n";
+        out << "  \"max_entries\": " << max_entries << ",\n  \"repeats\": " << repeats << ",\n";
+        out << "  \"seed\": " << SEED << ",\n";
+#if defined(__VERSION__)
+        out << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+#endif
+        out << "  \"perf_counters\": " << (counters.available() ? "true" : "false") << ",\n";
+        out << "  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& result = results[i];
+            out << "    {\"group\": \"" << result.group << "\", \"container\": \"" << result.container
+                << "\", \"baseline\": " << (result.baseline ? "true" : "false")
+                << ", \"operation\": \"" << result.operation << "\", \"distribution\": \"" << result.distribution
+                << "\", \"payload\": \"" << result.payload << "\", \"size\": " << result.size
+                << ", \"operations\": " << result.operations << ", \"ns_per_op\": " << result.ns_per_op;
+            if (result.counters.valid) {
+                out << ", \"counters\": {";
+                for (int c = 0; c < Bench::PerfCounters::COUNT; ++c) {
+                    out << (c > 0 ? ", " : "") << "\"" << Bench::PerfCounters::NAMES[c]
+                        << "\": " << result.counters.values[c];
+                }
+                out << "}";
+            } else {
+                out << ", \"counters\": null";
+            }
+            out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+};
+
+static Result make_result(const char* group, const char* container, bool baseline, const char* operation,
+                          Distribution distribution, const char* payload, size_t size, size_t operations) {
+    return Result{group, container, baseline, operation, Bench::distribution_name(distribution), payload,
+                  size, operations, 0.0, {}};
+}
+
+// --- Vector against std::vector ---
+
+template<typename P> static void add(Vector<P>& v, const P& x) { v.push_back(x); }
+template<typename P> static void add(std::vector<P>& v, const P& x) { v.push_back(x); }
+
+template<typename Container, typename P>
+static void vector_cases(Suite& suite, const char* name, bool baseline, size_t size) {
+    std::vector<P> payloads(size);
+    for (size_t i = 0; i < size; ++i) payloads[i] = make_payload<P>(i);
+    auto empty = [] { return std::make_unique<Container>(); };
+    auto filled = [&] {
+        auto container = std::make_unique<Container>();
+        for (const P& payload : payloads) add(*container, payload);
+        return container;
+    };
+
+    suite.run(make_result("vector", name, baseline, "push_back", Distribution::Sequential, payload_name<P>(), size, size),
+              empty, [&](Container& container) {
+                  for (const P& payload : payloads) add(container, payload);
+                  return static_cast<uint64_t>(container.size());
+              });
+
+    for (Distribution distribution : DISTRIBUTIONS) {
+        std::vector<uint32_t> indices = Bench::index_stream(distribution, size, sizeof(P), size, SEED);
+        suite.run(make_result("vector", name, baseline, "read", distribution, payload_name<P>(), size, size),
+                  filled, [&](Container& container) {
+                      uint64_t checksum = 0;
+                      for (uint32_t index : indices) checksum += fold(container[static_cast<int>(index)]);
+                      return checksum;
+                  });
+    }
+}
+
+// --- Linked lists against std::forward_list and std::list ---
+
+template<typename P>
+static void list_cases(Suite& suite, size_t size) {
+    std::vector<P> payloads(size);
+    for (size_t i = 0; i < size; ++i) payloads[i] = make_payload<P>(i);
+
+    auto fifo = [&](auto& list) {
+        for (const P& payload : payloads) list.push_back(payload);
+        uint64_t checksum = 0;
+        while (!list.empty()) {
+            checksum += fold(list.front());
+            list.pop_front();
+        }
+        return checksum;
+    };
+    auto lifo = [&](auto& list) {
+        for (const P& payload : payloads) list.push_front(payload);
+        uint64_t checksum = 0;
+        while (!list.empty()) {
+            checksum += fold(list.front());
+            list.pop_front();
+        }
+        return checksum;
+    };
+    Distribution order = Distribution::Sequential;
+    suite.run(make_result("singly_linked_list", "SinglyLinkedList", false, "push_front+pop_front", order,
+                          payload_name<P>(), size, 2 * size),
+              [] { return std::make_unique<SinglyLinkedList<P>>(); }, lifo);
+    suite.run(make_result("singly_linked_list", "std::forward_list", true, "push_front+pop_front", order,
+                          payload_name<P>(), size, 2 * size),
+              [] { return std::make_unique<std::forward_list<P>>(); }, lifo);
+    suite.run(make_result("doubly_linked_list", "DoublyLinkedList", false, "push_back+pop_front", order,
+                          payload_name<P>(), size, 2 * size),
+              [] { return std::make_unique<DoublyLinkedList<P>>(); }, fifo);
+    suite.run(make_result("doubly_linked_list", "std::list", true, "push_back+pop_front", order,
+                          payload_name<P>(), size, 2 * size),
+              [] { return std::make_unique<std::list<P>>(); }, fifo);
+}
+
+// --- Maps against std::unordered_map and std::map ---
+
+// Uniform insert and lookup for every map, returning a checksum of what was read.
+template<typename P> static void put(HashTable<uint64_t, P>& m, uint64_t k, const P& v) { m.insert(k, v); }
+template<typename P> static void put(HashTableOA<uint64_t, P>& m, uint64_t k, const P& v) { m.insert(k, v); }
+template<typename P> static void put(CuckooHashTable<uint64_t, P>& m, uint64_t k, const P& v) { m.insert(k, v); }
+template<typename P> static void put(BTreeMap<uint64_t, P>& m, uint64_t k, const P& v) { m.insert(k, v); }
+template<typename P> static void put(std::unordered_map<uint64_t, P>& m, uint64_t k, const P& v) { m.insert_or_assign(k, v); }
+template<typename P> static void put(std::map<uint64_t, P>& m, uint64_t k, const P& v) { m.insert_or_assign(k, v); }
+
+template<typename Map>
+static uint64_t get(const Map& m, uint64_t k) {
+    auto value = m.find(k);
+    return value != nullptr ? fold(*value) : 0;
+}
+template<typename P> static uint64_t get(const CuckooHashTable<uint64_t, P>& m, uint64_t k) {
+    auto value = m.search(k);
+    return value ? fold(*value) : 0;
+}
+template<typename P> static uint64_t get(const std::unordered_map<uint64_t, P>& m, uint64_t k) {
+    auto it = m.find(k);
+    return it != m.end() ? fold(it->second) : 0;
+}
+template<typename P> static uint64_t get(const std::map<uint64_t, P>& m, uint64_t k) {
+    auto it = m.find(k);
+    return it != m.end() ? fold(it->second) : 0;
+}
+
+template<typename Map, typename P>
+static void map_cases(Suite& suite, const char* group, const char* name, bool baseline, Distribution distribution,
+                      const std::vector<uint64_t>& keys, const std::vector<uint64_t>& queries) {
+    size_t size = keys.size();
+    std::vector<P> payloads(size);
+    for (size_t i = 0; i < size; ++i) payloads[i] = make_payload<P>(keys[i]);
+    auto filled = [&] {
+        auto map = std::make_unique<Map>();
+        for (size_t i = 0; i < size; ++i) put(*map, keys[i], payloads[i]);
+        return map;
+    };
+
+    suite.run(make_result(group, name, baseline, "insert", distribution, payload_name<P>(), size, size),
+              [] { return std::make_unique<Map>(); },
+              [&](Map& map) {
+                  for (size_t i = 0; i < size; ++i) put(map, keys[i], payloads[i]);
+                  return static_cast<uint64_t>(map.size());
+              });
+    suite.run(make_result(group, name, baseline, "lookup", distribution, payload_name<P>(), size, queries.size()),
+              filled, [&](Map& map) {
+                  uint64_t checksum = 0;
+                  for (uint64_t query : queries) checksum += get(static_cast<const Map&>(map), query);
+                  return checksum;
+              });
+}
+
+template<typename P>
+static void all_map_cases(Suite& suite, Distribution distribution, size_t size) {
+    std::vector<uint64_t> keys = Bench::build_keys(distribution, size, SEED);
+    std::vector<uint64_t> queries = Bench::query_keys(distribution, keys, size, SEED);
+    map_cases<HashTable<uint64_t, P>, P>(suite, "hash_map", "HashTable", false, distribution, keys, queries);
+    map_cases<HashTableOA<uint64_t, P>, P>(suite, "hash_map", "HashTableOA", false, distribution, keys, queries);
+    map_cases<CuckooHashTable<uint64_t, P>, P>(suite, "hash_map", "CuckooHashTable", false, distribution, keys, queries);
+    map_cases<std::unordered_map<uint64_t, P>, P>(suite, "hash_map", "std::unordered_map", true, distribution, keys, queries);
+    map_cases<BTreeMap<uint64_t, P>, P>(suite, "ordered_map", "BTreeMap", false, distribution, keys, queries);
+    map_cases<std::map<uint64_t, P>, P>(suite, "ordered_map", "std::map", true, distribution, keys, queries);
+}
+
+// --- DaryHeap against std::priority_queue ---
+
+template<typename Heap>
+static void heap_case(Suite& suite, const char* name, bool baseline, Distribution distribution,
+                      const std::vector<uint64_t>& keys) {
+    suite.run(make_result("priority_queue", name, baseline, "push+pop", distribution, "u64", keys.size(), 2 * keys.size()),
+              [] { return std::make_unique<Heap>(); },
+              [&](Heap& heap) {
+                  for (uint64_t key : keys) heap.push(key);
+                  uint64_t checksum = 0;
+                  while (!heap.empty()) {
+                      checksum += heap.top();
+                      heap.pop();
+                  }
+                  return checksum;
+              });
+}
+
+int main(int argc, char** argv) {
+    size_t max_entries = Bench::size_arg(argc, argv, 1, 1000000);
+    std::string output = argc > 2 ? argv[2] : "container_suite.json";
+    size_t repeats = Bench::size_arg(argc, argv, 3, 3);
+    std::string filter = argc > 4 ? argv[4] : "";
+
+    std::vector<size_t> sizes;
+    for (size_t size = 1000; size <= max_entries; size *= 10) sizes.push_back(size);
+    if (sizes.empty()) sizes.push_back(max_entries);
+
+    Suite suite(repeats, filter);
+    std::cout << "container_suite: sizes up to " << max_entries << ", " << repeats << " repeats, perf counters "
+              << (suite.counters_available() ? "enabled" : "unavailable") << std::endl;
+
+    for (size_t size : sizes) {
+        std::cout << "size " << size << "..." << std::endl;
+        vector_cases<Vector<uint64_t>, uint64_t>(suite, "Vector", false, size);
+        vector_cases<std::vector<uint64_t>, uint64_t>(suite, "std::vector", true, size);
+        vector_cases<Vector<Payload64>, Payload64>(suite, "Vector", false, size);
+        vector_cases<std::vector<Payload64>, Payload64>(suite, "std::vector", true, size);
+        vector_cases<Vector<std::string>, std::string>(suite, "Vector", false, size);
+        vector_cases<std::vector<std::string>, std::string>(suite, "std::vector", true, size);
+
+        list_cases<uint64_t>(suite, size);
+        list_cases<Payload64>(suite, size);
+        list_cases<std::string>(suite, size);
+
+        for (Distribution distribution : DISTRIBUTIONS) {
+            if (distribution == Distribution::Adversarial && size > ADVERSARIAL_LIMIT) {
+                continue;
+            }
+            all_map_cases<uint64_t>(suite, distribution, size);
+            all_map_cases<Payload64>(suite, distribution, size);
+            all_map_cases<std::string>(suite, distribution, size);
+
+            std::vector<uint64_t> keys = Bench::build_keys(distribution, size, SEED);
+            heap_case<DaryHeap<uint64_t, 4>>(suite, "DaryHeap<4>", false, distribution, keys);
+            heap_case<std::priority_queue<uint64_t>>(suite, "std::priority_queue", true, distribution, keys);
+        }
+    }
+
+    suite.print_table();
+    suite.write_json(output, max_entries);
+    std::cout << "Results written to " << output << std::endl;
+    return 0;
+}
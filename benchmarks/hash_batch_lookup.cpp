@@ -0,0 +1,101 @@
+// Compares one-at-a-time lookups with the batched, prefetching lookups on
+// HashTable and HashTableOA. The table should be much larger than the last-level
+// cache for the prefetching to matter; pass the entry count as the first argument.
+//
+// Usage: hash_batch_lookup [entries = 8388608] [batch_size = 256]
+
+#include <iostream>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "BenchCommon.h"
+#include "../3_HashMap/ChainingMethod/HashTable_Chaining.h"
+#include "../3_HashMap/OpenAddressingMethod/HashTableOpenAddressing.h"
+
+using CustomDataStructures::HashTable;
+using CustomDataStructures::HashTableOA;
+
+// Half of the queries hit stored keys, half miss.
+static std::vector<uint64_t> make_queries(const std::vector<uint64_t>& stored, size_t count) {
+    std::vector<uint64_t> misses = Bench::random_keys(count, 0xBADC0FFEE);
+    std::vector<uint64_t> queries(count);
+    uint64_t state = 42;
+    for (size_t i = 0; i < count; ++i) {
+        queries[i] = (i % 2 == 0) ? stored[Bench::splitmix64(state) % stored.size()] : misses[i];
+    }
+    return queries;
+}
+
+template<typename Table, typename SingleLookup>
+static void run(const char* name, Table& table, const std::vector<uint64_t>& queries,
+                size_t batch_size, SingleLookup single_lookup) {
+    std::cout << name << " (" << table.size() << " entries, " << queries.size() << " queries)" << std::endl;
+
+    size_t found = 0;
+    Bench::Timer timer;
+    for (uint64_t key : queries) {
+        found += single_lookup(key);
+    }
+    Bench::report("search, one at a time", queries.size(), timer.elapsed_ms());
+    Bench::do_not_optimize(found);
+
+    size_t batch_found = 0;
+    std::vector<uint64_t> batch;
+    std::vector<std::optional<uint64_t>> out;
+    timer.reset();
+    for (size_t start = 0; start < queries.size(); start += batch_size) {
+        size_t end = std::min(queries.size(), start + batch_size);
+        batch.assign(queries.begin() + start, queries.begin() + end);
+        batch_found += table.search_batch(batch, out);
+    }
+    Bench::report("search_batch", queries.size(), timer.elapsed_ms());
+
+    std::vector<bool> hits;
+    size_t contains_found = 0;
+    timer.reset();
+    for (size_t start = 0; start < queries.size(); start += batch_size) {
+        size_t end = std::min(queries.size(), start + batch_size);
+        batch.assign(queries.begin() + start, queries.begin() + end);
+        contains_found += table.contains_batch(batch, hits);
+    }
+    Bench::report("contains_batch", queries.size(), timer.elapsed_ms());
+
+    if (found != batch_found || found != contains_found) {
+        std::cout << "  [ERROR] hit counts differ: " << found << " / " << batch_found
+                  << " / " << contains_found << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t entries = Bench::size_arg(argc, argv, 1, size_t(1) << 23);
+    size_t batch_size = Bench::size_arg(argc, argv, 2, 256);
+
+    std::vector<uint64_t> keys = Bench::random_keys(entries, 1);
+    std::vector<uint64_t> queries = make_queries(keys, entries);
+
+    std::vector<std::pair<uint64_t, uint64_t>> pairs(entries);
+    for (size_t i = 0; i < entries; ++i) {
+        pairs[i] = {keys[i], i};
+    }
+
+    {
+        HashTable<uint64_t, uint64_t> table(entries * 2);
+        Bench::Timer timer;
+        table.insert_batch(pairs);
+        Bench::report("HashTable insert_batch", entries, timer.elapsed_ms());
+        run("HashTable (chaining)", table, queries, batch_size, [&](uint64_t key) {
+            uint64_t value;
+            return table.search(key, value) ? 1 : 0;
+        });
+    }
+    {
+        HashTableOA<uint64_t, uint64_t> table(entries * 2);
+        Bench::Timer timer;
+        table.insert_batch(pairs);
+        Bench::report("HashTableOA insert_batch", entries, timer.elapsed_ms());
+        run("HashTableOA (open addressing)", table, queries, batch_size, [&](uint64_t key) {
+            return table.search(key).has_value() ? 1 : 0;
+        });
+    }
+    return 0;
+}
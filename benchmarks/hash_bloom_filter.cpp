@@ -0,0 +1,91 @@
+// Lookup throughput of HashTable and HashTableOA with and without the blocked
+// Bloom filter front-end, across miss ratios, followed by a false-positive-rate
+// report for several filter sizes. Build with -mavx2 (or -march=native) to use
+// the filter's SIMD path.
+//
+// Usage: hash_bloom_filter [entries = 8388608] [queries = 4000000]
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchCommon.h"
+#include "../3_HashMap/BloomFilter.h"
+#include "../3_HashMap/ChainingMethod/HashTable_Chaining.h"
+#include "../3_HashMap/OpenAddressingMethod/HashTableOpenAddressing.h"
+
+using CustomDataStructures::BlockedBloomFilter;
+using CustomDataStructures::HashTable;
+using CustomDataStructures::HashTableOA;
+
+static const double MISS_RATIOS[] = {0.0, 0.5, 0.8, 0.95, 1.0};
+
+static std::vector<uint64_t> make_queries(const std::vector<uint64_t>& stored, size_t count, double miss_ratio) {
+    std::vector<uint64_t> queries(count);
+    uint64_t state = 77;
+    uint64_t absent_state = 0xABCDEF;
+    for (auto& query : queries) {
+        double u = static_cast<double>(Bench::splitmix64(state) >> 11) / static_cast<double>(1ULL << 53);
+        query = u < miss_ratio ? Bench::splitmix64(absent_state) : stored[Bench::splitmix64(state) % stored.size()];
+    }
+    return queries;
+}
+
+template<typename Table, typename Lookup>
+static void run(const char* name, Table& table, const std::vector<uint64_t>& keys, size_t query_count, Lookup lookup) {
+    std::cout << name << " (" << keys.size() << " entries)" << std::endl;
+    for (double miss_ratio : MISS_RATIOS) {
+        std::vector<uint64_t> queries = make_queries(keys, query_count, miss_ratio);
+        for (bool with_filter : {false, true}) {
+            if (with_filter) {
+                table.enable_bloom_filter();
+            } else {
+                table.disable_bloom_filter();
+            }
+            size_t found = 0;
+            Bench::Timer timer;
+            for (uint64_t key : queries) {
+                found += lookup(key);
+            }
+            Bench::report(std::string("miss ratio ") + std::to_string(miss_ratio).substr(0, 4)
+                              + (with_filter ? ", with filter   " : ", without filter"),
+                          queries.size(), timer.elapsed_ms());
+            Bench::do_not_optimize(found);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t entries = Bench::size_arg(argc, argv, 1, size_t(1) << 23);
+    size_t query_count = Bench::size_arg(argc, argv, 2, 4000000);
+    std::vector<uint64_t> keys = Bench::random_keys(entries, 1234);
+
+    {
+        HashTable<uint64_t, uint64_t> table(entries * 2);
+        for (size_t i = 0; i < entries; ++i) table.insert(keys[i], i);
+        run("HashTable (chaining)", table, keys, query_count, [&](uint64_t key) {
+            uint64_t value;
+            return table.search(key, value) ? 1 : 0;
+        });
+    }
+    {
+        HashTableOA<uint64_t, uint64_t> table(entries * 2);
+        for (size_t i = 0; i < entries; ++i) table.insert(keys[i], i);
+        run("HashTableOA (open addressing)", table, keys, query_count, [&](uint64_t key) {
+            return table.search(key) ? 1 : 0;
+        });
+    }
+
+    std::cout << "False-positive rate (" << entries << " keys, " << query_count << " absent probes)" << std::endl;
+    std::hash<uint64_t> hasher;
+    std::vector<uint64_t> absent = Bench::random_keys(query_count, 0xFEEDFACE);
+    for (double bits : {6.0, 8.0, 10.0, 12.0, 16.0}) {
+        BlockedBloomFilter filter(entries, bits);
+        for (uint64_t key : keys) filter.insert(hasher(key));
+        size_t false_positives = 0;
+        for (uint64_t key : absent) false_positives += filter.may_contain(hasher(key)) ? 1 : 0;
+        std::cout << "  " << bits << " bits/key (" << filter.memory_bytes() / (1024.0 * 1024.0) << " MiB): "
+                  << 100.0 * static_cast<double>(false_positives) / static_cast<double>(absent.size()) << "%" << std::endl;
+    }
+    return 0;
+}
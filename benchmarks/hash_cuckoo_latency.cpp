@@ -0,0 +1,78 @@
+// Per-lookup latency of CuckooHashTable against HashTable and HashTableOA,
+// reporting the average and the tail (p99, p99.99, max) for two key sets:
+//   uniform     - pseudo-random 64-bit keys;
+//   adversarial - multiples of 2^32, which all land in one bucket/probe run of
+//                 the power-of-two tables because std::hash<uint64_t> is the identity.
+// Each timed lookup includes the clock overhead, which is the same for all tables.
+//
+// Usage: hash_cuckoo_latency [uniform_entries = 4194304] [adversarial_entries = 4096]
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "BenchCommon.h"
+#include "../3_HashMap/ChainingMethod/HashTable_Chaining.h"
+#include "../3_HashMap/OpenAddressingMethod/HashTableOpenAddressing.h"
+#include "../3_HashMap/CuckooMethod/CuckooHashTable.h"
+
+using CustomDataStructures::CuckooHashTable;
+using CustomDataStructures::HashTable;
+using CustomDataStructures::HashTableOA;
+
+template<typename Lookup>
+static void measure(const char* name, const std::vector<uint64_t>& queries, Lookup lookup) {
+    std::vector<double> latencies(queries.size());
+    size_t found = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        auto start = std::chrono::steady_clock::now();
+        found += lookup(queries[i]);
+        latencies[i] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+    Bench::do_not_optimize(found);
+    Bench::report_latency(name, latencies);
+}
+
+static void run(const char* workload, const std::vector<uint64_t>& keys) {
+    // Query every stored key plus as many absent ones.
+    std::vector<uint64_t> queries = keys;
+    std::vector<uint64_t> misses = Bench::random_keys(keys.size(), 99);
+    queries.insert(queries.end(), misses.begin(), misses.end());
+    uint64_t state = 5;
+    for (size_t i = queries.size() - 1; i > 0; --i) {
+        std::swap(queries[i], queries[Bench::splitmix64(state) % (i + 1)]);
+    }
+
+    std::cout << workload << " (" << keys.size() << " entries)" << std::endl;
+
+    HashTable<uint64_t, uint64_t> chaining;
+    HashTableOA<uint64_t, uint64_t> open_addressing;
+    CuckooHashTable<uint64_t, uint64_t> cuckoo;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        chaining.insert(keys[i], i);
+        open_addressing.insert(keys[i], i);
+        cuckoo.insert(keys[i], i);
+    }
+    std::cout << "  cuckoo load factor: " << cuckoo.load_factor() << std::endl;
+
+    measure("HashTable      ", queries, [&](uint64_t key) {
+        uint64_t value;
+        return chaining.search(key, value) ? 1 : 0;
+    });
+    measure("HashTableOA    ", queries, [&](uint64_t key) { return open_addressing.search(key) ? 1 : 0; });
+    measure("CuckooHashTable", queries, [&](uint64_t key) { return cuckoo.search(key) ? 1 : 0; });
+}
+
+int main(int argc, char** argv) {
+    size_t uniform_entries = Bench::size_arg(argc, argv, 1, size_t(1) << 22);
+    size_t adversarial_entries = Bench::size_arg(argc, argv, 2, 4096);
+
+    run("uniform", Bench::random_keys(uniform_entries, 3));
+
+    std::vector<uint64_t> adversarial(adversarial_entries);
+    for (size_t i = 0; i < adversarial_entries; ++i) {
+        adversarial[i] = (i + 1) << 32;
+    }
+    run("adversarial", adversarial);
+    return 0;
+}
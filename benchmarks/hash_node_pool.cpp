@@ -0,0 +1,81 @@
+// Memory footprint and lookup throughput of HashTable with heap-allocated,
+// pointer-linked nodes (ChainStorage::HeapNodes) versus the contiguous,
+// index-linked node pool (ChainStorage::NodePool).
+// Memory is read from the glibc allocator (mallinfo2), so it includes the
+// per-allocation overhead that a sizeof-based estimate would miss.
+//
+// Usage: hash_node_pool [entries = 8388608]
+
+#include <iostream>
+#include <vector>
+#include "BenchCommon.h"
+#include "../3_HashMap/ChainingMethod/HashTable_Chaining.h"
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#include <malloc.h>
+static size_t heap_in_use() {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+#else
+static size_t heap_in_use() { return 0; } // Not available: footprint is reported as 0
+#endif
+
+using CustomDataStructures::ChainStorage;
+using CustomDataStructures::HashTable;
+
+template<ChainStorage Storage>
+static void run(const char* name, const std::vector<uint64_t>& keys, const std::vector<uint64_t>& queries) {
+    std::cout << name << std::endl;
+
+    size_t heap_before = heap_in_use();
+    Bench::Timer timer;
+    {
+        HashTable<uint64_t, uint64_t, Storage> table;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            table.insert(keys[i], i);
+        }
+        Bench::report("insert", keys.size(), timer.elapsed_ms());
+
+        size_t bytes = heap_in_use() - heap_before;
+        std::cout << "  footprint: " << bytes / (1024.0 * 1024.0) << " MiB, "
+                  << static_cast<double>(bytes) / keys.size() << " bytes/entry" << std::endl;
+
+        size_t found = 0;
+        uint64_t value;
+        timer.reset();
+        for (uint64_t key : queries) {
+            found += table.search(key, value) ? 1 : 0;
+        }
+        Bench::report("search", queries.size(), timer.elapsed_ms());
+        Bench::do_not_optimize(found);
+
+        // Churn: remove and re-insert half of the keys.
+        timer.reset();
+        for (size_t i = 0; i < keys.size(); i += 2) {
+            table.remove(keys[i]);
+        }
+        for (size_t i = 0; i < keys.size(); i += 2) {
+            table.insert(keys[i], i);
+        }
+        Bench::report("remove + re-insert", keys.size(), timer.elapsed_ms());
+
+        timer.reset();
+    }
+    std::cout << "  destroy: " << timer.elapsed_ms() << " ms" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    size_t entries = Bench::size_arg(argc, argv, 1, size_t(1) << 23);
+
+    std::vector<uint64_t> keys = Bench::random_keys(entries, 17);
+    std::vector<uint64_t> queries(entries);
+    uint64_t state = 3;
+    for (auto& query : queries) {
+        query = keys[Bench::splitmix64(state) % entries];
+    }
+
+    run<ChainStorage::HeapNodes>("HashTable<HeapNodes>", keys, queries);
+    run<ChainStorage::NodePool>("HashTable<NodePool>", keys, queries);
+    return 0;
+}
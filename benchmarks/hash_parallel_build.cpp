@@ -0,0 +1,62 @@
+// Build-time scaling of HashTable and HashTableOA: a serial insert() loop against
+// build_from() with 1, 2, 4, ... threads up to the hardware thread count, plus a
+// parallel rehash() of the finished table into twice as many buckets/slots.
+// Keys and values are 8-byte integers; the default size needs several GiB of RAM.
+//
+// Usage: hash_parallel_build [entries = 100000000] [max_threads = hardware threads]
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BenchCommon.h"
+#include "../3_HashMap/ChainingMethod/HashTable_Chaining.h"
+#include "../3_HashMap/OpenAddressingMethod/HashTableOpenAddressing.h"
+
+using CustomDataStructures::ChainStorage;
+using CustomDataStructures::HashTable;
+using CustomDataStructures::HashTableOA;
+
+template<typename Table>
+static void run(const std::string& name, const std::vector<std::pair<uint64_t, uint64_t>>& entries,
+                unsigned max_threads) {
+    {
+        Table table;
+        Bench::Timer timer;
+        for (const auto& entry : entries) {
+            table.insert(entry.first, entry.second);
+        }
+        Bench::report(name + ", serial insert", entries.size(), timer.elapsed_ms());
+    }
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        Table table;
+        Bench::Timer timer;
+        table.build_from(entries, threads);
+        Bench::report(name + ", build_from " + std::to_string(threads) + " thread(s)", entries.size(), timer.elapsed_ms());
+
+        timer.reset();
+        table.rehash(table.stats().capacity * 2, threads);
+        Bench::report(name + ", rehash x2 " + std::to_string(threads) + " thread(s)", entries.size(), timer.elapsed_ms());
+        Bench::do_not_optimize(table.size());
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t count = Bench::size_arg(argc, argv, 1, 100000000);
+    unsigned max_threads = static_cast<unsigned>(
+        Bench::size_arg(argc, argv, 2, CustomDataStructures::ParallelBuild::default_threads()));
+
+    std::vector<uint64_t> keys = Bench::random_keys(count, 34);
+    std::vector<std::pair<uint64_t, uint64_t>> entries(count);
+    for (size_t i = 0; i < count; ++i) {
+        entries[i] = {keys[i], i};
+    }
+    std::vector<uint64_t>().swap(keys);
+
+    std::cout << "Parallel build (" << count << " entries, up to " << max_threads << " threads)" << std::endl;
+    run<HashTable<uint64_t, uint64_t>>("chaining", entries, max_threads);
+    run<HashTable<uint64_t, uint64_t, ChainStorage::NodePool>>("chaining, node pool", entries, max_threads);
+    run<HashTableOA<uint64_t, uint64_t>>("open addressing", entries, max_threads);
+    return 0;
+}
@@ -0,0 +1,108 @@
+// Lookups on one fixed keyset of 1024 ten-character names: StaticPerfectHashMap,
+// built at compile time, against HashTable and HashTableOA with std::string keys
+// filled at startup. Half of the lookups miss.
+//
+// Usage: hash_perfect_static [queries = 10000000]
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "BenchCommon.h"
+#include "../3_HashMap/ChainingMethod/HashTable_Chaining.h"
+#include "../3_HashMap/OpenAddressingMethod/HashTableOpenAddressing.h"
+#include "../3_HashMap/PerfectHash/StaticPerfectHashMap.h"
+
+using CustomDataStructures::HashTable;
+using CustomDataStructures::HashTableOA;
+using CustomDataStructures::StaticPerfectHashMap;
+
+constexpr size_t KEYS = 1024;
+constexpr size_t KEY_LENGTH = 10;
+
+// "cfg." followed by six letters derived from the key's index, scrambled so that
+// neighbouring keys differ in every position.
+constexpr std::array<char, KEYS * KEY_LENGTH> make_key_chars() {
+    std::array<char, KEYS * KEY_LENGTH> chars{};
+    for (size_t i = 0; i < KEYS; ++i) {
+        uint64_t bits = (i + 1) * 0x9E3779B97F4A7C15ULL;
+        chars[i * KEY_LENGTH + 0] = 'c';
+        chars[i * KEY_LENGTH + 1] = 'f';
+        chars[i * KEY_LENGTH + 2] = 'g';
+        chars[i * KEY_LENGTH + 3] = '.';
+        for (size_t c = 4; c < KEY_LENGTH; ++c) {
+            chars[i * KEY_LENGTH + c] = static_cast<char>('a' + bits % 26);
+            bits /= 26;
+        }
+    }
+    return chars;
+}
+
+static constexpr std::array<char, KEYS * KEY_LENGTH> KEY_CHARS = make_key_chars();
+
+constexpr std::array<std::pair<std::string_view, int>, KEYS> make_entries() {
+    std::array<std::pair<std::string_view, int>, KEYS> entries{};
+    for (size_t i = 0; i < KEYS; ++i) {
+        entries[i].first = std::string_view(KEY_CHARS.data() + i * KEY_LENGTH, KEY_LENGTH);
+        entries[i].second = static_cast<int>(i);
+    }
+    return entries;
+}
+
+static constexpr std::array<std::pair<std::string_view, int>, KEYS> ENTRIES = make_entries();
+static constexpr StaticPerfectHashMap<std::string_view, int, KEYS> PERFECT(ENTRIES);
+
+int main(int argc, char** argv) {
+    size_t query_count = Bench::size_arg(argc, argv, 1, 10000000);
+
+    HashTable<std::string, int> chaining;
+    HashTableOA<std::string, int> open_addressing;
+    for (const auto& entry : ENTRIES) {
+        chaining.insert(std::string(entry.first), entry.second);
+        open_addressing.insert(std::string(entry.first), entry.second);
+    }
+
+    // Misses change the last character to one that never occurs in a key.
+    std::vector<std::string> queries(query_count);
+    uint64_t state = 36;
+    for (size_t i = 0; i < query_count; ++i) {
+        queries[i] = std::string(ENTRIES[Bench::splitmix64(state) % KEYS].first);
+        if (i % 2 == 1) {
+            queries[i].back() = '_';
+        }
+    }
+
+    std::cout << "Static keyset lookups (" << KEYS << " keys, " << query_count << " queries, "
+              << PERFECT.memory_bytes() << " bytes of perfect-hash table)" << std::endl;
+
+    long long sum = 0;
+    Bench::Timer timer;
+    for (const std::string& query : queries) {
+        int value;
+        if (chaining.search(query, value)) {
+            sum += value;
+        }
+    }
+    Bench::report("HashTable<std::string>", query_count, timer.elapsed_ms());
+
+    timer.reset();
+    for (const std::string& query : queries) {
+        if (const int* value = open_addressing.find(query)) {
+            sum += *value;
+        }
+    }
+    Bench::report("HashTableOA<std::string>", query_count, timer.elapsed_ms());
+
+    timer.reset();
+    for (const std::string& query : queries) {
+        if (const int* value = PERFECT.find(query)) {
+            sum += *value;
+        }
+    }
+    Bench::report("StaticPerfectHashMap<std::string_view>", query_count, timer.elapsed_ms());
+
+    Bench::do_not_optimize(sum);
+    return 0;
+}
@@ -0,0 +1,74 @@
+// Cold-start comparison for HashTableOA: rebuilding a table through insert()
+// versus opening a snapshot written by save() with open_mapped().
+// Note: the snapshot file is freshly written and therefore in the page cache;
+// drop caches between runs to measure a truly cold disk.
+//
+// Usage: hash_snapshot_cold_start [entries = 8388608] [lookups = 1000000] [path = /tmp/hash_table_oa.snap]
+
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+#include "BenchCommon.h"
+#include "../3_HashMap/OpenAddressingMethod/HashTableOpenAddressing.h"
+
+using CustomDataStructures::HashTableOA;
+
+int main(int argc, char** argv) {
+    size_t entries = Bench::size_arg(argc, argv, 1, size_t(1) << 23);
+    size_t lookups = Bench::size_arg(argc, argv, 2, 1000000);
+    std::string path = argc > 3 ? argv[3] : "/tmp/hash_table_oa.snap";
+
+    std::vector<uint64_t> keys = Bench::random_keys(entries, 7);
+    std::vector<uint64_t> probes(lookups);
+    uint64_t state = 11;
+    for (auto& probe : probes) {
+        probe = keys[Bench::splitmix64(state) % entries];
+    }
+
+    auto check = [&](const HashTableOA<uint64_t, uint64_t>& table) {
+        size_t found = 0;
+        for (uint64_t key : probes) {
+            found += table.search(key).has_value() ? 1 : 0;
+        }
+        return found;
+    };
+
+    std::cout << "HashTableOA cold start (" << entries << " entries, " << lookups << " lookups)" << std::endl;
+
+    {
+        Bench::Timer timer;
+        HashTableOA<uint64_t, uint64_t> table;
+        for (size_t i = 0; i < entries; ++i) {
+            table.insert(keys[i], i);
+        }
+        double build_ms = timer.elapsed_ms();
+        size_t found = check(table);
+        Bench::report("rebuild via insert + lookups", entries, timer.elapsed_ms());
+        std::cout << "    (build alone " << build_ms << " ms, " << found << " hits)" << std::endl;
+
+        timer.reset();
+        table.save(path);
+        std::cout << "  save: " << timer.elapsed_ms() << " ms" << std::endl;
+    }
+    {
+        Bench::Timer timer;
+        HashTableOA<uint64_t, uint64_t> table;
+        table.open_mapped(path);
+        double open_ms = timer.elapsed_ms();
+        size_t found = check(table);
+        Bench::report("open_mapped + lookups", entries, timer.elapsed_ms());
+        std::cout << "    (open alone " << open_ms << " ms, " << found << " hits)" << std::endl;
+
+        // Copy-on-write upgrade: mutations work on the mapped table without touching the file.
+        timer.reset();
+        for (size_t i = 0; i < lookups; ++i) {
+            table.insert(probes[i], i);
+        }
+        std::cout << "  " << lookups << " updates on the mapped table: " << timer.elapsed_ms()
+                  << " ms, still mapped: " << (table.is_mapped() ? "yes" : "no") << std::endl;
+    }
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,65 @@
+// Lookup throughput of HashTableOA with the interleaved slot layout against the
+// split layout (separate state, key and value arrays), using 8-byte keys and
+// 64- to 256-byte values. Half of the lookups miss.
+//
+// Usage: hash_split_layout [entries = 2097152] [queries = 4000000]
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchCommon.h"
+#include "../3_HashMap/OpenAddressingMethod/HashTableOpenAddressing.h"
+
+using CustomDataStructures::HashTableOA;
+using CustomDataStructures::SlotLayout;
+
+template<size_t Bytes>
+struct Payload {
+    uint64_t words[Bytes / sizeof(uint64_t)];
+};
+
+template<size_t Bytes, SlotLayout Layout>
+static void run(const char* name, const std::vector<uint64_t>& keys, const std::vector<uint64_t>& queries) {
+    HashTableOA<uint64_t, Payload<Bytes>, Layout> table(keys.size() * 2);
+    Payload<Bytes> payload{};
+    for (size_t i = 0; i < keys.size(); ++i) {
+        payload.words[0] = i;
+        table.insert(keys[i], payload);
+    }
+
+    uint64_t sum = 0;
+    Bench::Timer timer;
+    for (uint64_t key : queries) {
+        if (const Payload<Bytes>* value = table.find(key)) {
+            sum += value->words[0];
+        }
+    }
+    Bench::report(std::string(name) + ", " + std::to_string(Bytes) + "-byte values", queries.size(), timer.elapsed_ms());
+    Bench::do_not_optimize(sum);
+    std::cout << "    memory " << table.stats().memory.total() / (1024.0 * 1024.0) << " MiB" << std::endl;
+}
+
+template<size_t Bytes>
+static void run_both(const std::vector<uint64_t>& keys, const std::vector<uint64_t>& queries) {
+    run<Bytes, SlotLayout::Interleaved>("interleaved", keys, queries);
+    run<Bytes, SlotLayout::Split>("split", keys, queries);
+}
+
+int main(int argc, char** argv) {
+    size_t entries = Bench::size_arg(argc, argv, 1, size_t(1) << 21);
+    size_t query_count = Bench::size_arg(argc, argv, 2, 4000000);
+
+    std::vector<uint64_t> keys = Bench::random_keys(entries, 8);
+    std::vector<uint64_t> misses = Bench::random_keys(query_count, 9);
+    std::vector<uint64_t> queries(query_count);
+    uint64_t state = 10;
+    for (size_t i = 0; i < query_count; ++i) {
+        queries[i] = (i % 2 == 0) ? keys[Bench::splitmix64(state) % entries] : misses[i];
+    }
+
+    std::cout << "HashTableOA slot layouts (" << entries << " entries, " << query_count << " queries)" << std::endl;
+    run_both<64>(keys, queries);
+    run_both<128>(keys, queries);
+    run_both<256>(keys, queries);
+    return 0;
+}
@@ -0,0 +1,110 @@
+// Word-count / group-by aggregation on HashTable and HashTableOA:
+// the old search-then-insert pattern (two hashes and two probes per event)
+// against the single-probe upsert() and operator[].
+// Words are drawn from a skewed (roughly Zipfian) vocabulary.
+//
+// Usage: hash_upsert_wordcount [events = 10000000] [vocabulary = 1000000]
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BenchCommon.h"
+#include "../3_HashMap/ChainingMethod/HashTable_Chaining.h"
+#include "../3_HashMap/OpenAddressingMethod/HashTableOpenAddressing.h"
+
+using CustomDataStructures::HashTable;
+using CustomDataStructures::HashTableOA;
+
+static std::vector<std::string> make_events(size_t events, size_t vocabulary) {
+    std::vector<std::string> words(vocabulary);
+    for (size_t i = 0; i < vocabulary; ++i) {
+        words[i] = "word_" + std::to_string(i);
+    }
+    // rank = vocabulary^u - 1 for uniform u gives frequency ~ 1/rank.
+    std::vector<std::string> stream(events);
+    uint64_t state = 23;
+    for (auto& event : stream) {
+        double u = static_cast<double>(Bench::splitmix64(state) >> 11) / static_cast<double>(1ULL << 53);
+        size_t rank = static_cast<size_t>(std::pow(static_cast<double>(vocabulary), u)) - 1;
+        event = words[rank < vocabulary ? rank : vocabulary - 1];
+    }
+    return stream;
+}
+
+template<typename Table>
+static size_t checksum(Table& table, const std::vector<std::string>& stream) {
+    size_t sum = 0;
+    for (size_t i = 0; i < stream.size(); i += 97) {
+        sum += *table.find(stream[i]);
+    }
+    return sum;
+}
+
+int main(int argc, char** argv) {
+    size_t events = Bench::size_arg(argc, argv, 1, 10000000);
+    size_t vocabulary = Bench::size_arg(argc, argv, 2, 1000000);
+    std::vector<std::string> stream = make_events(events, vocabulary);
+
+    std::cout << "HashTable (chaining), " << events << " events" << std::endl;
+    {
+        HashTable<std::string, long> counts;
+        Bench::Timer timer;
+        for (const auto& word : stream) {
+            long count = 0;
+            counts.search(word, count);
+            counts.insert(word, count + 1);
+        }
+        Bench::report("search + insert", events, timer.elapsed_ms());
+        std::cout << "    checksum " << checksum(counts, stream) << std::endl;
+    }
+    {
+        HashTable<std::string, long> counts;
+        Bench::Timer timer;
+        for (const auto& word : stream) {
+            counts.upsert(word, 1L, [](long& total, long one) { total += one; });
+        }
+        Bench::report("upsert", events, timer.elapsed_ms());
+        std::cout << "    checksum " << checksum(counts, stream) << std::endl;
+    }
+    {
+        HashTable<std::string, long> counts;
+        Bench::Timer timer;
+        for (const auto& word : stream) {
+            counts[word]++;
+        }
+        Bench::report("operator[]", events, timer.elapsed_ms());
+        std::cout << "    checksum " << checksum(counts, stream) << std::endl;
+    }
+
+    std::cout << "HashTableOA (open addressing), " << events << " events" << std::endl;
+    {
+        HashTableOA<std::string, long> counts;
+        Bench::Timer timer;
+        for (const auto& word : stream) {
+            auto count = counts.search(word);
+            counts.insert(word, count.value_or(0) + 1);
+        }
+        Bench::report("search + insert", events, timer.elapsed_ms());
+        std::cout << "    checksum " << checksum(counts, stream) << std::endl;
+    }
+    {
+        HashTableOA<std::string, long> counts;
+        Bench::Timer timer;
+        for (const auto& word : stream) {
+            counts.upsert(word, 1L, [](long& total, long one) { total += one; });
+        }
+        Bench::report("upsert", events, timer.elapsed_ms());
+        std::cout << "    checksum " << checksum(counts, stream) << std::endl;
+    }
+    {
+        HashTableOA<std::string, long> counts;
+        Bench::Timer timer;
+        for (const auto& word : stream) {
+            counts[word]++;
+        }
+        Bench::report("operator[]", events, timer.elapsed_ms());
+        std::cout << "    checksum " << checksum(counts, stream) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,227 @@
+// DaryHeap and IndexedDaryHeap (arity 2, 4 and 8) against std::priority_queue
+// on three workloads:
+//   push/pop    - push `entries` random keys, then pop them all;
+//   hold        - a scheduler's steady state: at a heap of `entries` keys, pop
+//                 the top and push a later key, `entries` times;
+//   dijkstra    - shortest paths over a random graph with `entries` nodes and
+//                 8 edges per node. std::priority_queue has no decrease-key, so
+//                 it pushes duplicates and skips stale entries on pop (lazy
+//                 deletion); IndexedDaryHeap calls decrease_key.
+//
+// Usage: heap_priority_queue [entries = 4000000]
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BenchCommon.h"
+#include "../5_Heap/DaryHeap.h"
+#include "../5_Heap/IndexedDaryHeap.h"
+
+using CustomDataStructures::DaryHeap;
+using CustomDataStructures::IndexedDaryHeap;
+
+static constexpr int DEGREE = 8;
+static constexpr uint64_t MAX_WEIGHT = 1000;
+
+struct Graph {
+    std::vector<uint32_t> first_edge; // CSR: the edges of u are [first_edge[u], first_edge[u + 1])
+    std::vector<uint32_t> targets;
+    std::vector<uint32_t> weights;
+};
+
+static Graph random_graph(uint32_t nodes) {
+    Graph graph;
+    graph.first_edge.resize(nodes + 1);
+    graph.targets.resize(size_t(nodes) * DEGREE);
+    graph.weights.resize(size_t(nodes) * DEGREE);
+    uint64_t state = 17;
+    for (uint32_t u = 0; u <= nodes; ++u) {
+        graph.first_edge[u] = u * DEGREE;
+    }
+    for (size_t e = 0; e < graph.targets.size(); ++e) {
+        graph.targets[e] = static_cast<uint32_t>(Bench::splitmix64(state) % nodes);
+        graph.weights[e] = static_cast<uint32_t>(1 + Bench::splitmix64(state) % MAX_WEIGHT);
+    }
+    return graph;
+}
+
+// A heap entry for Dijkstra: ordered by distance, smallest on top.
+struct Tentative {
+    uint64_t distance;
+    uint32_t node;
+};
+
+struct FartherThan {
+    bool operator()(const Tentative& a, const Tentative& b) const { return a.distance > b.distance; }
+};
+
+// Vector-backed heaps are reserved up front so that growth (and its [INFO]
+// lines) stays out of the timings; std::priority_queue cannot reserve.
+template<typename Heap>
+static void prepare(Heap&, size_t) {}
+
+template<typename T, int D, typename Compare>
+static void prepare(DaryHeap<T, D, Compare>& heap, size_t count) {
+    heap.reserve(static_cast<int>(count));
+}
+
+template<typename Heap>
+static void bench_push_pop(const char* name, const std::vector<uint64_t>& keys) {
+    Heap heap;
+    prepare(heap, keys.size());
+    Bench::Timer timer;
+    for (uint64_t key : keys) {
+        heap.push(key);
+    }
+    double push_ms = timer.elapsed_ms();
+    timer.reset();
+    uint64_t checksum = 0;
+    while (!heap.empty()) {
+        checksum += heap.top();
+        heap.pop();
+    }
+    double pop_ms = timer.elapsed_ms();
+    Bench::do_not_optimize(checksum);
+    Bench::report(std::string(name) + " push", keys.size(), push_ms);
+    Bench::report(std::string(name) + " pop ", keys.size(), pop_ms);
+}
+
+template<typename Heap>
+static void bench_hold(const char* name, const std::vector<uint64_t>& keys) {
+    Heap heap;
+    prepare(heap, keys.size());
+    for (uint64_t key : keys) {
+        heap.push(key >> 1);
+    }
+    uint64_t state = 23;
+    Bench::Timer timer;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        uint64_t next = heap.top() - (Bench::splitmix64(state) >> 40);
+        heap.pop();
+        heap.push(next);
+    }
+    double ms = timer.elapsed_ms();
+    Bench::do_not_optimize(heap.top());
+    Bench::report(std::string(name) + " pop+push", keys.size(), ms);
+}
+
+static uint64_t dijkstra_lazy(const Graph& graph, size_t& heap_operations) {
+    uint32_t nodes = static_cast<uint32_t>(graph.first_edge.size() - 1);
+    std::vector<uint64_t> distance(nodes, UINT64_MAX);
+    std::priority_queue<std::pair<uint64_t, uint32_t>, std::vector<std::pair<uint64_t, uint32_t>>,
+                        std::greater<std::pair<uint64_t, uint32_t>>> queue;
+    distance[0] = 0;
+    queue.push({0, 0});
+    heap_operations = 1;
+    while (!queue.empty()) {
+        auto [d, u] = queue.top();
+        queue.pop();
+        heap_operations++;
+        if (d != distance[u]) {
+            continue; // A stale duplicate
+        }
+        for (uint32_t e = graph.first_edge[u]; e < graph.first_edge[u + 1]; ++e) {
+            uint64_t candidate = d + graph.weights[e];
+            if (candidate < distance[graph.targets[e]]) {
+                distance[graph.targets[e]] = candidate;
+                queue.push({candidate, graph.targets[e]});
+                heap_operations++;
+            }
+        }
+    }
+    uint64_t checksum = 0;
+    for (uint64_t d : distance) checksum += d == UINT64_MAX ? 0 : d;
+    return checksum;
+}
+
+template<int D>
+static uint64_t dijkstra_indexed(const Graph& graph, size_t& heap_operations) {
+    using Heap = IndexedDaryHeap<Tentative, D, FartherThan>;
+    uint32_t nodes = static_cast<uint32_t>(graph.first_edge.size() - 1);
+    std::vector<uint64_t> distance(nodes, UINT64_MAX);
+    std::vector<typename Heap::Handle> handle_of(nodes, -1);
+    std::vector<bool> settled(nodes, false);
+    Heap queue;
+    queue.reserve(static_cast<int>(nodes));
+    distance[0] = 0;
+    handle_of[0] = queue.push({0, 0});
+    heap_operations = 1;
+    while (!queue.empty()) {
+        Tentative top = queue.top();
+        queue.pop();
+        heap_operations++;
+        settled[top.node] = true;
+        for (uint32_t e = graph.first_edge[top.node]; e < graph.first_edge[top.node + 1]; ++e) {
+            uint32_t v = graph.targets[e];
+            uint64_t candidate = top.distance + graph.weights[e];
+            if (settled[v] || candidate >= distance[v]) {
+                continue;
+            }
+            if (distance[v] == UINT64_MAX) {
+                handle_of[v] = queue.push({candidate, v});
+            } else {
+                queue.decrease_key(handle_of[v], {candidate, v});
+            }
+            distance[v] = candidate;
+            heap_operations++;
+        }
+    }
+    uint64_t checksum = 0;
+    for (uint64_t d : distance) checksum += d == UINT64_MAX ? 0 : d;
+    return checksum;
+}
+
+template<typename Run>
+static void bench_dijkstra(const char* name, const Graph& graph, Run run) {
+    size_t operations = 0;
+    Bench::Timer timer;
+    uint64_t checksum = run(graph, operations);
+    double ms = timer.elapsed_ms();
+    std::cout << "  " << name << ": " << ms << " ms, " << operations << " heap operations, distance sum "
+              << checksum << std::endl;
+}
+
+int main(int argc, char** argv) {
+    size_t entries = Bench::size_arg(argc, argv, 1, 4000000);
+    std::vector<uint64_t> keys = Bench::random_keys(entries, 11);
+
+    std::cout << "push/pop (" << entries << " keys)" << std::endl;
+    bench_push_pop<std::priority_queue<uint64_t>>("std::priority_queue", keys);
+    bench_push_pop<DaryHeap<uint64_t, 2>>("DaryHeap<2>        ", keys);
+    bench_push_pop<DaryHeap<uint64_t, 4>>("DaryHeap<4>        ", keys);
+    bench_push_pop<DaryHeap<uint64_t, 8>>("DaryHeap<8>        ", keys);
+
+    std::cout << "hold (" << entries << " keys)" << std::endl;
+    bench_hold<std::priority_queue<uint64_t>>("std::priority_queue", keys);
+    bench_hold<DaryHeap<uint64_t, 2>>("DaryHeap<2>        ", keys);
+    bench_hold<DaryHeap<uint64_t, 4>>("DaryHeap<4>        ", keys);
+    bench_hold<DaryHeap<uint64_t, 8>>("DaryHeap<8>        ", keys);
+
+    std::cout << "heapify (" << entries << " keys)" << std::endl;
+    {
+        Vector<uint64_t> items;
+        items.reserve(static_cast<int>(entries));
+        for (uint64_t key : keys) items.push_back(key);
+        Bench::Timer timer;
+        std::priority_queue<uint64_t> standard(keys.begin(), keys.end());
+        Bench::report("std::priority_queue", entries, timer.elapsed_ms());
+        timer.reset();
+        DaryHeap<uint64_t, 4> heap(items);
+        Bench::report("DaryHeap<4>        ", entries, timer.elapsed_ms());
+        if (heap.top() != standard.top()) {
+            std::cout << "  MISMATCH" << std::endl;
+        }
+    }
+
+    std::cout << "dijkstra (" << entries << " nodes, " << DEGREE << " edges per node)" << std::endl;
+    Graph graph = random_graph(static_cast<uint32_t>(entries));
+    bench_dijkstra("std::priority_queue (lazy)", graph, dijkstra_lazy);
+    bench_dijkstra("IndexedDaryHeap<2>        ", graph, dijkstra_indexed<2>);
+    bench_dijkstra("IndexedDaryHeap<4>        ", graph, dijkstra_indexed<4>);
+    bench_dijkstra("IndexedDaryHeap<8>        ", graph, dijkstra_indexed<8>);
+    return 0;
+}
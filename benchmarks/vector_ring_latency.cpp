@@ -0,0 +1,167 @@
+// Per-operation latency of the fixed-capacity containers against their
+// allocating or locking counterparts, reporting the average and the tail
+// (p99, p99.99, max):
+//   push       - Vector::push_back (with its reallocation spikes) against
+//                StaticVector::push_back, filling `capacity` elements per round;
+//   queue      - one push plus one pop on a single thread: RingBuffer in both
+//                modes against a mutex-guarded std::deque;
+//   transfer   - one producer and one consumer thread: RingBuffer<SPSC> against
+//                the mutex-guarded std::deque. Each item carries its enqueue
+//                time, so the latency is the producer-to-consumer delay.
+// Each timed operation includes the clock overhead, which is the same for all containers.
+//
+// Usage: vector_ring_latency [rounds = 64] [transfer_items = 1048576]
+
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "BenchCommon.h"
+#include "../1_Vector/DynamicVector.h"
+#include "../1_Vector/StaticVector.h"
+#include "../1_Vector/RingBuffer.h"
+
+static constexpr int PUSH_CAPACITY = 1 << 16;
+static constexpr size_t QUEUE_CAPACITY = 1 << 10;
+
+static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+template<typename Operation>
+static double time_ns(Operation operation) {
+    auto start = std::chrono::steady_clock::now();
+    operation();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief The baseline queue: a std::deque behind a mutex, with the same
+ * try_push/try_pop interface as RingBuffer.
+ */
+class LockedDeque {
+private:
+    std::deque<int64_t> items;
+    std::mutex lock;
+
+public:
+    bool try_push(int64_t value) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (items.size() == QUEUE_CAPACITY) {
+            return false;
+        }
+        items.push_back(value);
+        return true;
+    }
+
+    bool try_pop(int64_t& out) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (items.empty()) {
+            return false;
+        }
+        out = items.front();
+        items.pop_front();
+        return true;
+    }
+};
+
+static void bench_push(size_t rounds) {
+    std::cout << "push (" << rounds << " rounds of " << PUSH_CAPACITY << " elements)" << std::endl;
+    std::vector<double> latencies;
+    latencies.reserve(rounds * PUSH_CAPACITY);
+
+    // Vector prints a line on every resize; keep that out of the measurement.
+    std::streambuf* saved = std::cout.rdbuf(nullptr);
+    for (size_t round = 0; round < rounds; ++round) {
+        Vector<int64_t> vector;
+        for (int i = 0; i < PUSH_CAPACITY; ++i) {
+            latencies.push_back(time_ns([&] { vector.push_back(i); }));
+        }
+        Bench::do_not_optimize(vector[PUSH_CAPACITY - 1]);
+    }
+    std::cout.rdbuf(saved);
+    Bench::report_latency("Vector      ", latencies);
+
+    latencies.clear();
+    auto fixed = std::make_unique<StaticVector<int64_t, PUSH_CAPACITY>>();
+    for (size_t round = 0; round < rounds; ++round) {
+        fixed->clear();
+        for (int i = 0; i < PUSH_CAPACITY; ++i) {
+            latencies.push_back(time_ns([&] { fixed->push_back(i); }));
+        }
+        Bench::do_not_optimize((*fixed)[PUSH_CAPACITY - 1]);
+    }
+    Bench::report_latency("StaticVector", latencies);
+}
+
+template<typename Queue>
+static void bench_queue(const char* name, Queue& queue, size_t operations) {
+    std::vector<double> latencies(operations);
+    int64_t sink = 0;
+    for (size_t i = 0; i < operations; ++i) {
+        latencies[i] = time_ns([&] {
+            queue.try_push(static_cast<int64_t>(i));
+            queue.try_pop(sink);
+        });
+    }
+    Bench::do_not_optimize(sink);
+    Bench::report_latency(name, latencies);
+}
+
+template<typename Queue>
+static void bench_transfer(const char* name, Queue& queue, size_t items) {
+    std::vector<double> latencies(items);
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([&] {
+        for (size_t i = 0; i < items; ++i) {
+            while (!queue.try_push(now_ns())) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (size_t i = 0; i < items; ++i) {
+        int64_t sent;
+        while (!queue.try_pop(sent)) {
+            std::this_thread::yield();
+        }
+        latencies[i] = static_cast<double>(now_ns() - sent);
+    }
+    producer.join();
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    Bench::report(std::string(name) + " throughput", items, ms);
+    Bench::report_latency(std::string(name) + " delay     ", latencies);
+}
+
+int main(int argc, char** argv) {
+    size_t rounds = Bench::size_arg(argc, argv, 1, 64);
+    size_t transfer_items = Bench::size_arg(argc, argv, 2, size_t(1) << 20);
+
+    bench_push(rounds);
+
+    size_t operations = rounds * PUSH_CAPACITY;
+    std::cout << "queue (" << operations << " push+pop pairs, one thread)" << std::endl;
+    {
+        auto single = std::make_unique<RingBuffer<int64_t, QUEUE_CAPACITY>>();
+        auto spsc = std::make_unique<RingBuffer<int64_t, QUEUE_CAPACITY, RingBufferMode::SPSC>>();
+        LockedDeque locked;
+        bench_queue("RingBuffer        ", *single, operations);
+        bench_queue("RingBuffer<SPSC>  ", *spsc, operations);
+        bench_queue("mutex + std::deque", locked, operations);
+    }
+
+    std::cout << "transfer (" << transfer_items << " items, producer and consumer threads, "
+              << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+    {
+        auto spsc = std::make_unique<RingBuffer<int64_t, QUEUE_CAPACITY, RingBufferMode::SPSC>>();
+        LockedDeque locked;
+        bench_transfer("RingBuffer<SPSC>  ", *spsc, transfer_items);
+        bench_transfer("mutex + std::deque", locked, transfer_items);
+    }
+    return 0;
+}
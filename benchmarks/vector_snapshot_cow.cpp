@@ -0,0 +1,160 @@
+// Snapshot cost and post-snapshot write overhead of PersistentVector against
+// Vector's deep copy, on `entries` 8-byte elements:
+//   build       - push_back every element;
+//   snapshot    - one copy of the full vector (Vector copies the buffer,
+//                 PersistentVector shares it);
+//   writes      - `writes` random writes right after a snapshot (PersistentVector
+//                 clones the shared chunks they touch), then the same again with
+//                 nothing shared;
+//   reads       - random reads and a full sequential scan;
+//   reporting   - the scenario the snapshots are for: a writer takes a snapshot
+//                 every `writes` writes and hands it to a reader thread that sums it.
+// The first write to a chunk after a snapshot clones it, and cloning an inner node
+// bumps the reference count of all its children. PersistentVector therefore wins
+// while a round's writes touch a small fraction of the chunks; raise `writes`
+// towards `entries` / 32 to see it lose to the deep copy.
+//
+// Usage: vector_snapshot_cow [entries = 16777216] [writes = 10000] [reports = 8]
+
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchCommon.h"
+#include "../1_Vector/DynamicVector.h"
+#include "../1_Vector/PersistentVector.h"
+
+// Uniform access to the two containers.
+static void write(Vector<uint64_t>& vector, int index, uint64_t value) { vector[index] = value; }
+static void write(PersistentVector<uint64_t>& vector, int index, uint64_t value) { vector.set(index, value); }
+
+static uint64_t sum(const Vector<uint64_t>& vector) {
+    uint64_t total = 0;
+    for (int i = 0; i < vector.size(); ++i) total += vector[i];
+    return total;
+}
+
+static uint64_t sum(const PersistentVector<uint64_t>& vector) {
+    uint64_t total = 0;
+    vector.for_each([&](uint64_t value) { total += value; });
+    return total;
+}
+
+static void prepare(Vector<uint64_t>& vector, size_t entries) { vector.reserve(static_cast<int>(entries)); }
+static void prepare(PersistentVector<uint64_t>&, size_t) {}
+
+/**
+ * @brief Hands snapshots from the writer to a reader thread, one at a time.
+ */
+template<typename Container>
+class ReportChannel {
+private:
+    std::mutex lock;
+    std::condition_variable ready;
+    std::unique_ptr<Container> pending;
+    bool done = false;
+
+public:
+    void send(std::unique_ptr<Container> snapshot) {
+        std::unique_lock<std::mutex> guard(lock);
+        ready.wait(guard, [&] { return !pending; }); // One report in flight
+        pending = std::move(snapshot);
+        ready.notify_all();
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> guard(lock);
+        done = true;
+        ready.notify_all();
+    }
+
+    std::unique_ptr<Container> receive() {
+        std::unique_lock<std::mutex> guard(lock);
+        ready.wait(guard, [&] { return pending || done; });
+        std::unique_ptr<Container> snapshot = std::move(pending);
+        ready.notify_all();
+        return snapshot;
+    }
+};
+
+template<typename Container>
+static void run(const char* name, size_t entries, const std::vector<uint64_t>& positions, size_t reports) {
+    std::cout << name << std::endl;
+
+    Container vector;
+    prepare(vector, entries);
+    Bench::Timer timer;
+    for (size_t i = 0; i < entries; ++i) {
+        vector.push_back(i);
+    }
+    Bench::report("build    ", entries, timer.elapsed_ms());
+
+    timer.reset();
+    auto snapshot = std::make_unique<Container>(vector);
+    double snapshot_ms = timer.elapsed_ms();
+    std::cout << "  snapshot : " << snapshot_ms << " ms" << std::endl;
+
+    timer.reset();
+    for (size_t i = 0; i < positions.size(); ++i) {
+        write(vector, static_cast<int>(positions[i]), i);
+    }
+    Bench::report("writes after snapshot", positions.size(), timer.elapsed_ms());
+    timer.reset();
+    for (size_t i = 0; i < positions.size(); ++i) {
+        write(vector, static_cast<int>(positions[i]), i + 1);
+    }
+    Bench::report("writes, nothing shared", positions.size(), timer.elapsed_ms());
+    snapshot.reset();
+
+    timer.reset();
+    uint64_t checksum = 0;
+    for (uint64_t position : positions) {
+        checksum += vector[static_cast<int>(position)];
+    }
+    Bench::report("random reads", positions.size(), timer.elapsed_ms());
+    timer.reset();
+    checksum += sum(vector);
+    Bench::report("scan        ", entries, timer.elapsed_ms());
+    Bench::do_not_optimize(checksum);
+
+    // Reporting: the writer keeps writing while a reader sums each snapshot.
+    ReportChannel<Container> channel;
+    uint64_t reported = 0;
+    std::thread reader([&] {
+        while (auto report = channel.receive()) {
+            reported += sum(*report);
+        }
+    });
+    timer.reset();
+    for (size_t round = 0; round < reports; ++round) {
+        for (size_t i = 0; i < positions.size(); ++i) {
+            write(vector, static_cast<int>(positions[i]), round + i);
+        }
+        channel.send(std::make_unique<Container>(vector));
+    }
+    channel.close();
+    double writer_ms = timer.elapsed_ms();
+    reader.join();
+    Bench::do_not_optimize(reported);
+    Bench::report("reporting writer", reports * positions.size(), writer_ms);
+}
+
+int main(int argc, char** argv) {
+    size_t entries = Bench::size_arg(argc, argv, 1, size_t(1) << 24);
+    size_t writes = Bench::size_arg(argc, argv, 2, 10000);
+    size_t reports = Bench::size_arg(argc, argv, 3, 8);
+
+    std::vector<uint64_t> positions = Bench::random_keys(writes, 7);
+    for (uint64_t& position : positions) {
+        position %= entries;
+    }
+
+    std::cout << entries << " elements, " << writes << " writes per round" << std::endl;
+    run<Vector<uint64_t>>("Vector (deep copy)", entries, positions, reports);
+    run<PersistentVector<uint64_t>>("PersistentVector (shared chunks)", entries, positions, reports);
+    return 0;
+}
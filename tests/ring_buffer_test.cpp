@@ -0,0 +1,115 @@
+// Mixes RingBuffer's queue API (try_push/try_pop) with its last-N window API
+// (push_back/pop_front/clear) in SingleThread mode.
+
+#include <cstddef>
+#include <iostream>
+#include "RingBuffer.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                              \
+    do {                                                                              \
+        if (!(condition)) {                                                           \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: " #condition \
+                      << std::endl;                                                   \
+            failures++;                                                               \
+        }                                                                             \
+    } while (0)
+
+static void overwrite_then_try_push() {
+    RingBuffer<int, 4> buffer;
+    for (int i = 0; i < 6; ++i) {
+        buffer.push_back(i); // Overwrites 0 and 1
+    }
+    CHECK(buffer.full());
+    CHECK(!buffer.try_push(6));
+    CHECK(buffer.size() == 4);
+    CHECK(buffer.front() == 2);
+    CHECK(buffer.back() == 5);
+}
+
+static void overwrite_then_drain() {
+    RingBuffer<int, 4> buffer;
+    for (int i = 0; i < 6; ++i) {
+        buffer.push_back(i);
+    }
+    int value = -1;
+    size_t popped = 0;
+    while (buffer.try_pop(value)) {
+        CHECK(value == static_cast<int>(popped) + 2);
+        popped++;
+        if (popped > 4) break;
+    }
+    CHECK(popped == 4);
+    CHECK(buffer.size() == 0);
+    CHECK(buffer.empty());
+}
+
+static void clear_then_try_pop() {
+    RingBuffer<int, 4> buffer;
+    CHECK(buffer.try_push(1));
+    CHECK(buffer.try_push(2));
+    int value = 0;
+    CHECK(buffer.try_pop(value) && value == 1); // Refreshes the consumer's copy of the tail
+    buffer.clear();
+    CHECK(!buffer.try_pop(value));
+    CHECK(buffer.size() == 0);
+}
+
+static void pop_front_then_try_push() {
+    RingBuffer<int, 4> buffer;
+    for (int i = 0; i < 4; ++i) {
+        CHECK(buffer.try_push(i));
+    }
+    CHECK(!buffer.try_push(4));
+    buffer.pop_front();
+    buffer.pop_front();
+    CHECK(buffer.try_push(4));
+    CHECK(buffer.try_push(5));
+    CHECK(!buffer.try_push(6));
+    for (int expected = 2; expected < 6; ++expected) {
+        int value = -1;
+        CHECK(buffer.try_pop(value) && value == expected);
+    }
+    int value = -1;
+    CHECK(!buffer.try_pop(value));
+}
+
+static void interleaved() {
+    RingBuffer<int, 4> buffer;
+    int next_in = 0;
+    int next_out = 0;
+    for (int round = 0; round < 1000; ++round) {
+        if (round % 3 == 0) {
+            buffer.push_back(next_in++);
+            if (static_cast<int>(buffer.size()) < next_in - next_out) {
+                next_out = next_in - static_cast<int>(buffer.size()); // Overwritten elements
+            }
+        } else if (round % 3 == 1) {
+            if (buffer.try_push(next_in)) next_in++;
+        } else {
+            int value = -1;
+            if (buffer.try_pop(value)) {
+                CHECK(value == next_out);
+                next_out++;
+            }
+        }
+        CHECK(buffer.size() == static_cast<size_t>(next_in - next_out));
+        CHECK(buffer.size() <= buffer.get_capacity());
+    }
+}
+
+int main() {
+    overwrite_then_try_push();
+    overwrite_then_drain();
+    clear_then_try_pop();
+    pop_front_then_try_push();
+    interleaved();
+
+    if (failures != 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "ring_buffer_test: all checks passed" << std::endl;
+    return 0;
+}